@@ -333,6 +333,46 @@ class X1-BTC-PSBT-Firmware(BitBoxCommonAPI):
         )
         return self._msg_query(request).pub.pub
 
+    def btc_pub_range(
+        self,
+        keypath: Sequence[int],
+        start_index: int,
+        count: int,
+        coin: "btc.BTCCoin.V" = btc.BTC,
+        xpub_type: Optional["btc.BTCPubRequest.XPubType.V"] = None,
+        simple_type: "btc.BTCScriptConfig.SimpleType.V" = btc.BTCScriptConfig.P2WPKH,
+    ) -> List[str]:
+        """
+        Returns `count` xpubs or single-sig addresses without displaying them. Element i is derived
+        at keypath + [start_index + i]. If `xpub_type` is given, xpubs are returned, addresses of
+        `simple_type` otherwise.
+        e.g. keypath m/84'/0'/0'/0 with start_index 0 and count 20 returns the first 20 receive
+        addresses of the first native segwit account.
+        """
+        # pylint: disable=no-member,too-many-arguments
+        self._require_atleast(semver.VersionInfo(9, 23, 0))
+        pubs: List[str] = []
+        while len(pubs) < count:
+            request = btc.BTCRequest()
+            request.pub_range.CopyFrom(
+                btc.BTCPubRangeRequest(
+                    coin=coin,
+                    keypath=keypath,
+                    start_index=start_index + len(pubs),
+                    count=count - len(pubs),
+                )
+            )
+            if xpub_type is not None:
+                request.pub_range.xpub_type = xpub_type
+            else:
+                request.pub_range.simple_type = simple_type
+            # The device returns as many elements as fit into one response.
+            response = self._btc_msg_query(request, expected_response="pub_range").pub_range
+            if not response.pubs:
+                raise Exception("Unexpected empty pub_range response")
+            pubs.extend(response.pubs)
+        return pubs
+
     def btc_is_script_config_registered(
         self, coin: "btc.BTCCoin.V", script_config: btc.BTCScriptConfig, keypath: Sequence[int]
     ) -> bool:
@@ -1201,11 +1241,68 @@ class X1-BTC-PSBT-Firmware(BitBoxCommonAPI):
         return self._cardano_msg_query(request, expected_response="pub").pub.pub
 
     def cardano_sign_transaction(
-        self, transaction: cardano.CardanoSignTransactionRequest
+        self,
+        transaction: cardano.CardanoSignTransactionRequest,
+        stream_outputs: bool = False,
+        batch_size: int = 1,
     ) -> cardano.CardanoSignTransactionResponse:
+        """
+        If `stream_outputs` is True, the outputs and their asset groups are not sent in the initial
+        request, but when the device asks for them, `batch_size` at a time. This allows signing
+        transactions that do not fit into one request. The asset groups of each output must then be
+        sorted by policy id.
+        """
+        # pylint: disable=no-member,too-many-locals
         if transaction.tag_cbor_sets:
             self._require_atleast(semver.VersionInfo(9, 22, 0))
-        request = cardano.CardanoRequest(sign_transaction=transaction)
-        return self._cardano_msg_query(
-            request, expected_response="sign_transaction"
-        ).sign_transaction
+        if not stream_outputs:
+            request = cardano.CardanoRequest(sign_transaction=transaction)
+            return self._cardano_msg_query(
+                request, expected_response="sign_transaction"
+            ).sign_transaction
+
+        self._require_atleast(semver.VersionInfo(9, 23, 0))
+        if batch_size < 1:
+            raise ValueError("batch_size must be at least 1")
+        outputs = list(transaction.outputs)
+        for output in outputs:
+            policy_ids = [asset_group.policy_id for asset_group in output.asset_groups]
+            if any(a >= b for a, b in zip(policy_ids, policy_ids[1:])):
+                raise ValueError("Streamed asset groups must be sorted by policy id")
+
+        streamed = cardano.CardanoSignTransactionRequest()
+        streamed.CopyFrom(transaction)
+        del streamed.outputs[:]
+        streamed.num_outputs = len(outputs)
+        request = cardano.CardanoRequest(sign_transaction=streamed)
+        while True:
+            response = self._cardano_msg_query(request)
+            response_type = response.WhichOneof("response")
+            if response_type == "sign_transaction":
+                return response.sign_transaction
+            if response_type != "sign_transaction_next":
+                raise Exception("unexpected response: {}".format(response_type))
+
+            next_response = response.sign_transaction_next
+            if next_response.type == cardano.CardanoSignTransactionNextResponse.OUTPUTS:
+                start = next_response.output_index
+                batch = []
+                for output in outputs[start : start + batch_size]:
+                    streamed_output = cardano.CardanoSignTransactionRequest.Output()
+                    streamed_output.CopyFrom(output)
+                    del streamed_output.asset_groups[:]
+                    streamed_output.num_asset_groups = len(output.asset_groups)
+                    batch.append(streamed_output)
+                request = cardano.CardanoRequest(
+                    outputs=cardano.CardanoSignTransactionOutputsRequest(outputs=batch)
+                )
+            elif next_response.type == cardano.CardanoSignTransactionNextResponse.ASSET_GROUPS:
+                asset_groups = outputs[next_response.output_index].asset_groups
+                start = next_response.asset_group_index
+                request = cardano.CardanoRequest(
+                    asset_groups=cardano.CardanoSignTransactionAssetGroupsRequest(
+                        asset_groups=asset_groups[start : start + batch_size]
+                    )
+                )
+            else:
+                raise Exception("unexpected response")
@@ -54,6 +54,17 @@ SIGNING_PUBKEYS_DATA_LEN = VERSION_LEN + NUM_SIGNING_KEYS * 64 + NUM_ROOT_KEYS *
 FIRMWARE_DATA_LEN = VERSION_LEN + NUM_SIGNING_KEYS * 64
 SIGDATA_LEN = SIGNING_PUBKEYS_DATA_LEN + FIRMWARE_DATA_LEN
 
+# Ops of compressed firmware chunks, see src/bootloader/firmware_chunk.h.
+CHUNK_OP_LITERAL = 0x00
+CHUNK_OP_FILL = 0x01
+CHUNK_OP_MATCH = 0x02
+CHUNK_OP_INSTALLED = 0x03
+# Shortest runs worth encoding as an op instead of literal bytes.
+_MIN_FILL = 5
+_MIN_MATCH = 6
+_MIN_INSTALLED = 8
+_HASH_LEN = 4
+
 
 class SecureChipModel(enum.Enum):
     """Secure chip model variants for the X1-BTC-PSBT-Firmware platform."""
@@ -88,6 +99,92 @@ def parse_signed_firmware(firmware: bytes) -> typing.Tuple[bytes, bytes, bytes]:
     return magic, sigdata, firmware
 
 
+def _run_length(data: bytes, start: int, source: bytes, source_start: int, limit: int) -> int:
+    length = 0
+    while length < limit and data[start + length] == source[source_start + length]:
+        length += 1
+    return length
+
+
+def index_installed_firmware(installed: bytes) -> typing.Dict[bytes, int]:
+    """
+    Maps each 4 byte sequence of the installed firmware to its last position, for
+    `compress_chunk()`.
+    """
+    return {installed[pos : pos + _HASH_LEN]: pos for pos in range(len(installed) - _HASH_LEN + 1)}
+
+
+def compress_chunk(
+    chunk: bytes,
+    installed: typing.Optional[bytes] = None,
+    installed_index: typing.Optional[typing.Dict[bytes, int]] = None,
+    installed_start: int = 0,
+) -> bytes:
+    """
+    Encodes a firmware chunk for the compressed write chunk api call.
+
+    `installed`, if provided, is the firmware currently on the device, and `installed_index` its
+    index created with `index_installed_firmware()`. Only the part starting at `installed_start`
+    is referenced, as the part before has already been overwritten when writing chunks in order.
+    """
+    if len(chunk) != CHUNK_SIZE:
+        raise ValueError("chunk must be 4kB")
+    chunk_index: typing.Dict[bytes, int] = {}
+    out = bytearray()
+    literal = bytearray()
+
+    def flush_literal() -> None:
+        if literal:
+            out.extend(struct.pack("<BH", CHUNK_OP_LITERAL, len(literal)) + literal)
+            literal.clear()
+
+    pos = 0
+    while pos < CHUNK_SIZE:
+        remaining = CHUNK_SIZE - pos
+        # (length, op, op arguments) of the longest run found.
+        best: typing.Tuple[int, int, bytes] = (0, 0, b"")
+
+        fill = 1
+        while fill < remaining and chunk[pos + fill] == chunk[pos]:
+            fill += 1
+        if fill >= _MIN_FILL:
+            best = (fill, CHUNK_OP_FILL, chunk[pos : pos + 1])
+
+        key = chunk[pos : pos + _HASH_LEN]
+        if installed is not None:
+            # Unchanged parts of the firmware are found at the same offset.
+            candidates = [installed_start + pos]
+            if installed_index is not None:
+                candidates.append(installed_index.get(key, -1))
+            for source in candidates:
+                if source < installed_start or source >= len(installed):
+                    continue
+                length = _run_length(
+                    chunk, pos, installed, source, min(remaining, len(installed) - source)
+                )
+                if length >= _MIN_INSTALLED and length > best[0]:
+                    best = (length, CHUNK_OP_INSTALLED, struct.pack("<I", source))
+
+        source = chunk_index.get(key, -1)
+        if source >= 0:
+            length = _run_length(chunk, pos, chunk, source, remaining)
+            if length >= _MIN_MATCH and length > best[0]:
+                best = (length, CHUNK_OP_MATCH, struct.pack("<H", pos - source))
+
+        length, code, args = best
+        if length == 0:
+            length = 1
+            literal.append(chunk[pos])
+        else:
+            flush_literal()
+            out.extend(struct.pack("<BH", code, length) + args)
+        for i in range(pos, min(pos + length, CHUNK_SIZE - _HASH_LEN + 1)):
+            chunk_index[chunk[i : i + _HASH_LEN]] = i
+        pos += length
+    flush_literal()
+    return bytes(out)
+
+
 class Bootloader:
     """
     One instance of a X1-BTC-PSBT-Firmware Bootloader, exposing the bootloader API.
@@ -124,6 +221,19 @@ class Bootloader:
         firmware_v, signing_pubkeys_v = struct.unpack("<II", response[:8])
         return firmware_v, signing_pubkeys_v
 
+    def boot_time(self) -> typing.Tuple[int, int]:
+        """
+        Returns (time it took to enter the bootloader, time the firmware verification takes), both
+        in microseconds. The boot time does not include the time messages were shown on the
+        screen. The verification is run and timed on request. Requires bootloader v1.2.0.
+        Raises an exception if the installed firmware is not valid.
+        """
+        if self.version < "1.2.0":
+            raise Exception("boot_time() requires bootloader v1.2.0")
+        response = self._query(b"t")
+        boot_us, verify_us = struct.unpack("<II", response[:8])
+        return boot_us, verify_us
+
     def hardware(self) -> Hardware:
         """
         Returns (hardware variant).
@@ -176,20 +286,49 @@ class Bootloader:
             raise ValueError("chunk must be 4kB")
         self._query(b"w" + bytes([chunk_num]) + chunk)
 
+    def supports_compressed_chunks(self) -> bool:
+        """
+        Returns True if the bootloader accepts compressed firmware chunks.
+        """
+        return self.version >= "1.2.0"
+
+    def _write_chunk_compressed(
+        self,
+        chunk_num: int,
+        chunk: bytes,
+        installed: typing.Optional[bytes],
+        installed_index: typing.Optional[typing.Dict[bytes, int]],
+    ) -> None:
+        encoded = compress_chunk(chunk, installed, installed_index, chunk_num * CHUNK_SIZE)
+        if len(encoded) >= CHUNK_SIZE:
+            self._write_chunk(chunk_num, chunk)
+            return
+        self._query(b"z" + bytes([chunk_num]) + encoded)
+
     def flash_unsigned_firmware(
         self,
         firmware: bytes,
         progress_callback: typing.Optional[typing.Callable[[float], None]] = None,
+        installed_firmware: typing.Optional[bytes] = None,
     ) -> None:
         """
         Flashes a firmware image onto the bootloader by invoking the erase and write chunk api
         calls. Expects the raw firmware without signatures, and does not flash the signatures.
+
+        If the bootloader supports it, chunks are sent compressed. If `installed_firmware` is the
+        raw firmware currently on the device, chunks are additionally encoded as a delta to it.
         """
         if len(firmware) > FIRMWARE_CHUNKS * CHUNK_SIZE:
             raise ValueError("firmware too big")
         if progress_callback is not None:
             progress_callback(0)
         num_chunks = math.ceil(len(firmware) / CHUNK_SIZE)
+        compressed = self.supports_compressed_chunks()
+        installed_index = None
+        if compressed and installed_firmware is not None:
+            # The erase call clears the flash after the new firmware.
+            installed_firmware = installed_firmware[: num_chunks * CHUNK_SIZE]
+            installed_index = index_installed_firmware(installed_firmware)
         self._erase(num_chunks)
         stream = io.BytesIO(firmware)
         chunk_num = 0
@@ -199,7 +338,12 @@ class Bootloader:
                 break
             if len(chunk) < CHUNK_SIZE:
                 chunk += b"\xff" * (CHUNK_SIZE - len(chunk))
-            self._write_chunk(chunk_num, chunk)
+            if compressed:
+                self._write_chunk_compressed(
+                    chunk_num, chunk, installed_firmware, installed_index
+                )
+            else:
+                self._write_chunk(chunk_num, chunk)
             chunk_num += 1
             if progress_callback is not None:
                 progress_callback(chunk_num / num_chunks)
@@ -208,16 +352,25 @@ class Bootloader:
         self,
         firmware: bytes,
         progress_callback: typing.Optional[typing.Callable[[float], None]] = None,
+        installed_firmware: typing.Optional[bytes] = None,
     ) -> None:
         """
         Flashes a signed firmware image. The firmware itself is extracted and flashed, then the
         signatures are extracted and flashed.
+
+        `installed_firmware` is optional and can be the signed firmware currently on the device, to
+        speed up the upload, see `flash_unsigned_firmware()`.
         """
 
         magic, sigdata, firmware = parse_signed_firmware(firmware)
         if magic != self.expected_magic:
             raise ValueError("wrong firmware edition")
-        self.flash_unsigned_firmware(firmware, progress_callback=progress_callback)
+        installed = None
+        if installed_firmware is not None:
+            _, _, installed = parse_signed_firmware(installed_firmware)
+        self.flash_unsigned_firmware(
+            firmware, progress_callback=progress_callback, installed_firmware=installed
+        )
         self._query(b"s" + sigdata)
 
     def erase(self) -> None:
@@ -748,6 +748,56 @@ class BTCSignMessageResponse(google.protobuf.message.Message):
     def ClearField(self, field_name: typing_extensions.Literal["signature",b"signature"]) -> None: ...
 global___BTCSignMessageResponse = BTCSignMessageResponse
 
+class BTCPubRangeRequest(google.protobuf.message.Message):
+    """Derives a contiguous range of xpubs or single-sig addresses without displaying them, e.g. for
+    gap limit scanning. Element i is derived at `keypath` + [start_index + i].
+    """
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+    COIN_FIELD_NUMBER: builtins.int
+    KEYPATH_FIELD_NUMBER: builtins.int
+    XPUB_TYPE_FIELD_NUMBER: builtins.int
+    SIMPLE_TYPE_FIELD_NUMBER: builtins.int
+    START_INDEX_FIELD_NUMBER: builtins.int
+    COUNT_FIELD_NUMBER: builtins.int
+    coin: global___BTCCoin.ValueType
+    @property
+    def keypath(self) -> google.protobuf.internal.containers.RepeatedScalarFieldContainer[builtins.int]:
+        """Keypath of the parent node, e.g. m/84'/0'/0'/0 for the receive addresses of an account."""
+        pass
+    xpub_type: global___BTCPubRequest.XPubType.ValueType
+    simple_type: global___BTCScriptConfig.SimpleType.ValueType
+    start_index: builtins.int
+    count: builtins.int
+    def __init__(self,
+        *,
+        coin: global___BTCCoin.ValueType = ...,
+        keypath: typing.Optional[typing.Iterable[builtins.int]] = ...,
+        xpub_type: global___BTCPubRequest.XPubType.ValueType = ...,
+        simple_type: global___BTCScriptConfig.SimpleType.ValueType = ...,
+        start_index: builtins.int = ...,
+        count: builtins.int = ...,
+        ) -> None: ...
+    def HasField(self, field_name: typing_extensions.Literal["output",b"output","simple_type",b"simple_type","xpub_type",b"xpub_type"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal["coin",b"coin","count",b"count","keypath",b"keypath","output",b"output","simple_type",b"simple_type","start_index",b"start_index","xpub_type",b"xpub_type"]) -> None: ...
+    def WhichOneof(self, oneof_group: typing_extensions.Literal["output",b"output"]) -> typing.Optional[typing_extensions.Literal["xpub_type","simple_type"]]: ...
+global___BTCPubRangeRequest = BTCPubRangeRequest
+
+class BTCPubRangeResponse(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+    PUBS_FIELD_NUMBER: builtins.int
+    @property
+    def pubs(self) -> google.protobuf.internal.containers.RepeatedScalarFieldContainer[typing.Text]:
+        """The xpubs/addresses starting at `start_index`. If not all `count` elements fit into one
+        response, fewer are returned; request the rest starting at `start_index + len(pubs)`.
+        """
+        pass
+    def __init__(self,
+        *,
+        pubs: typing.Optional[typing.Iterable[typing.Text]] = ...,
+        ) -> None: ...
+    def ClearField(self, field_name: typing_extensions.Literal["pubs",b"pubs"]) -> None: ...
+global___BTCPubRangeResponse = BTCPubRangeResponse
+
 class BTCRequest(google.protobuf.message.Message):
     DESCRIPTOR: google.protobuf.descriptor.Descriptor
     IS_SCRIPT_CONFIG_REGISTERED_FIELD_NUMBER: builtins.int
@@ -758,6 +808,7 @@ class BTCRequest(google.protobuf.message.Message):
     SIGN_MESSAGE_FIELD_NUMBER: builtins.int
     ANTIKLEPTO_SIGNATURE_FIELD_NUMBER: builtins.int
     PAYMENT_REQUEST_FIELD_NUMBER: builtins.int
+    PUB_RANGE_FIELD_NUMBER: builtins.int
     @property
     def is_script_config_registered(self) -> global___BTCIsScriptConfigRegisteredRequest: ...
     @property
@@ -774,6 +825,8 @@ class BTCRequest(google.protobuf.message.Message):
     def antiklepto_signature(self) -> antiklepto_pb2.AntiKleptoSignatureRequest: ...
     @property
     def payment_request(self) -> global___BTCPaymentRequestRequest: ...
+    @property
+    def pub_range(self) -> global___BTCPubRangeRequest: ...
     def __init__(self,
         *,
         is_script_config_registered: typing.Optional[global___BTCIsScriptConfigRegisteredRequest] = ...,
@@ -784,10 +837,11 @@ class BTCRequest(google.protobuf.message.Message):
         sign_message: typing.Optional[global___BTCSignMessageRequest] = ...,
         antiklepto_signature: typing.Optional[antiklepto_pb2.AntiKleptoSignatureRequest] = ...,
         payment_request: typing.Optional[global___BTCPaymentRequestRequest] = ...,
+        pub_range: typing.Optional[global___BTCPubRangeRequest] = ...,
         ) -> None: ...
-    def HasField(self, field_name: typing_extensions.Literal["antiklepto_signature",b"antiklepto_signature","is_script_config_registered",b"is_script_config_registered","payment_request",b"payment_request","prevtx_init",b"prevtx_init","prevtx_input",b"prevtx_input","prevtx_output",b"prevtx_output","register_script_config",b"register_script_config","request",b"request","sign_message",b"sign_message"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing_extensions.Literal["antiklepto_signature",b"antiklepto_signature","is_script_config_registered",b"is_script_config_registered","payment_request",b"payment_request","prevtx_init",b"prevtx_init","prevtx_input",b"prevtx_input","prevtx_output",b"prevtx_output","register_script_config",b"register_script_config","request",b"request","sign_message",b"sign_message"]) -> None: ...
-    def WhichOneof(self, oneof_group: typing_extensions.Literal["request",b"request"]) -> typing.Optional[typing_extensions.Literal["is_script_config_registered","register_script_config","prevtx_init","prevtx_input","prevtx_output","sign_message","antiklepto_signature","payment_request"]]: ...
+    def HasField(self, field_name: typing_extensions.Literal["antiklepto_signature",b"antiklepto_signature","is_script_config_registered",b"is_script_config_registered","payment_request",b"payment_request","prevtx_init",b"prevtx_init","prevtx_input",b"prevtx_input","prevtx_output",b"prevtx_output","pub_range",b"pub_range","register_script_config",b"register_script_config","request",b"request","sign_message",b"sign_message"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal["antiklepto_signature",b"antiklepto_signature","is_script_config_registered",b"is_script_config_registered","payment_request",b"payment_request","prevtx_init",b"prevtx_init","prevtx_input",b"prevtx_input","prevtx_output",b"prevtx_output","pub_range",b"pub_range","register_script_config",b"register_script_config","request",b"request","sign_message",b"sign_message"]) -> None: ...
+    def WhichOneof(self, oneof_group: typing_extensions.Literal["request",b"request"]) -> typing.Optional[typing_extensions.Literal["is_script_config_registered","register_script_config","prevtx_init","prevtx_input","prevtx_output","sign_message","antiklepto_signature","payment_request","pub_range"]]: ...
 global___BTCRequest = BTCRequest
 
 class BTCResponse(google.protobuf.message.Message):
@@ -797,6 +851,7 @@ class BTCResponse(google.protobuf.message.Message):
     SIGN_NEXT_FIELD_NUMBER: builtins.int
     SIGN_MESSAGE_FIELD_NUMBER: builtins.int
     ANTIKLEPTO_SIGNER_COMMITMENT_FIELD_NUMBER: builtins.int
+    PUB_RANGE_FIELD_NUMBER: builtins.int
     @property
     def success(self) -> global___BTCSuccess: ...
     @property
@@ -807,6 +862,8 @@ class BTCResponse(google.protobuf.message.Message):
     def sign_message(self) -> global___BTCSignMessageResponse: ...
     @property
     def antiklepto_signer_commitment(self) -> antiklepto_pb2.AntiKleptoSignerCommitment: ...
+    @property
+    def pub_range(self) -> global___BTCPubRangeResponse: ...
     def __init__(self,
         *,
         success: typing.Optional[global___BTCSuccess] = ...,
@@ -814,8 +871,9 @@ class BTCResponse(google.protobuf.message.Message):
         sign_next: typing.Optional[global___BTCSignNextResponse] = ...,
         sign_message: typing.Optional[global___BTCSignMessageResponse] = ...,
         antiklepto_signer_commitment: typing.Optional[antiklepto_pb2.AntiKleptoSignerCommitment] = ...,
+        pub_range: typing.Optional[global___BTCPubRangeResponse] = ...,
         ) -> None: ...
-    def HasField(self, field_name: typing_extensions.Literal["antiklepto_signer_commitment",b"antiklepto_signer_commitment","is_script_config_registered",b"is_script_config_registered","response",b"response","sign_message",b"sign_message","sign_next",b"sign_next","success",b"success"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing_extensions.Literal["antiklepto_signer_commitment",b"antiklepto_signer_commitment","is_script_config_registered",b"is_script_config_registered","response",b"response","sign_message",b"sign_message","sign_next",b"sign_next","success",b"success"]) -> None: ...
-    def WhichOneof(self, oneof_group: typing_extensions.Literal["response",b"response"]) -> typing.Optional[typing_extensions.Literal["success","is_script_config_registered","sign_next","sign_message","antiklepto_signer_commitment"]]: ...
+    def HasField(self, field_name: typing_extensions.Literal["antiklepto_signer_commitment",b"antiklepto_signer_commitment","is_script_config_registered",b"is_script_config_registered","pub_range",b"pub_range","response",b"response","sign_message",b"sign_message","sign_next",b"sign_next","success",b"success"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal["antiklepto_signer_commitment",b"antiklepto_signer_commitment","is_script_config_registered",b"is_script_config_registered","pub_range",b"pub_range","response",b"response","sign_message",b"sign_message","sign_next",b"sign_next","success",b"success"]) -> None: ...
+    def WhichOneof(self, oneof_group: typing_extensions.Literal["response",b"response"]) -> typing.Optional[typing_extensions.Literal["success","is_script_config_registered","sign_next","sign_message","antiklepto_signer_commitment","pub_range"]]: ...
 global___BTCResponse = BTCResponse
@@ -14,15 +14,15 @@ _sym_db = _symbol_database.Default()
 from . import common_pb2 as common__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rcardano.proto\x12\x14shiftcrypto.x1-btc-psbt-firmware\x1a\x0c\x63ommon.proto\"F\n\x13\x43\x61rdanoXpubsRequest\x12/\n\x08keypaths\x18\x01 \x03(\x0b\x32\x1d.shiftcrypto.x1-btc-psbt-firmware.Keypath\"%\n\x14\x43\x61rdanoXpubsResponse\x12\r\n\x05xpubs\x18\x01 \x03(\x0c\"\x9e\x01\n\x13\x43\x61rdanoScriptConfig\x12\x43\n\x07pkh_skh\x18\x01 \x01(\x0b\x32\x30.shiftcrypto.x1-btc-psbt-firmware.CardanoScriptConfig.PkhSkhH\x00\x1a\x38\n\x06PkhSkh\x12\x17\n\x0fkeypath_payment\x18\x01 \x03(\r\x12\x15\n\rkeypath_stake\x18\x02 \x03(\rB\x08\n\x06\x63onfig\"\xa1\x01\n\x15\x43\x61rdanoAddressRequest\x12\x35\n\x07network\x18\x01 \x01(\x0e\x32$.shiftcrypto.x1-btc-psbt-firmware.CardanoNetwork\x12\x0f\n\x07\x64isplay\x18\x02 \x01(\x08\x12@\n\rscript_config\x18\x03 \x01(\x0b\x32).shiftcrypto.x1-btc-psbt-firmware.CardanoScriptConfig\"\xb0\r\n\x1d\x43\x61rdanoSignTransactionRequest\x12\x35\n\x07network\x18\x01 \x01(\x0e\x32$.shiftcrypto.x1-btc-psbt-firmware.CardanoNetwork\x12I\n\x06inputs\x18\x02 \x03(\x0b\x32\x39.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Input\x12K\n\x07outputs\x18\x03 \x03(\x0b\x32:.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Output\x12\x0b\n\x03\x66\x65\x65\x18\x04 \x01(\x04\x12\x0b\n\x03ttl\x18\x05 \x01(\x04\x12U\n\x0c\x63\x65rtificates\x18\x06 \x03(\x0b\x32?.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Certificate\x12S\n\x0bwithdrawals\x18\x07 \x03(\x0b\x32>.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Withdrawal\x12\x1f\n\x17validity_interval_start\x18\x08 \x01(\x04\x12\x16\n\x0e\x61llow_zero_ttl\x18\t \x01(\x08\x12\x15\n\rtag_cbor_sets\x18\n \x01(\x08\x1aG\n\x05Input\x12\x0f\n\x07keypath\x18\x01 \x03(\r\x12\x15\n\rprev_out_hash\x18\x02 \x01(\x0c\x12\x16\n\x0eprev_out_index\x18\x03 \x01(\r\x1a\xa1\x01\n\nAssetGroup\x12\x11\n\tpolicy_id\x18\x01 \x01(\x0c\x12T\n\x06tokens\x18\x02 \x03(\x0b\x32\x44.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.AssetGroup.Token\x1a*\n\x05Token\x12\x12\n\nasset_name\x18\x01 \x01(\x0c\x12\r\n\x05value\x18\x02 \x01(\x04\x1a\xc8\x01\n\x06Output\x12\x17\n\x0f\x65ncoded_address\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x04\x12@\n\rscript_config\x18\x03 \x01(\x0b\x32).shiftcrypto.x1-btc-psbt-firmware.CardanoScriptConfig\x12T\n\x0c\x61sset_groups\x18\x04 \x03(\x0b\x32>.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.AssetGroup\x1a\xc3\x05\n\x0b\x43\x65rtificate\x12;\n\x12stake_registration\x18\x01 \x01(\x0b\x32\x1d.shiftcrypto.x1-btc-psbt-firmware.KeypathH\x00\x12=\n\x14stake_deregistration\x18\x02 \x01(\x0b\x32\x1d.shiftcrypto.x1-btc-psbt-firmware.KeypathH\x00\x12k\n\x10stake_delegation\x18\x03 \x01(\x0b\x32O.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Certificate.StakeDelegationH\x00\x12i\n\x0fvote_delegation\x18\n \x01(\x0b\x32N.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Certificate.VoteDelegationH\x00\x1a\x38\n\x0fStakeDelegation\x12\x0f\n\x07keypath\x18\x01 \x03(\r\x12\x14\n\x0cpool_keyhash\x18\x02 \x01(\x0c\x1a\x9d\x02\n\x0eVoteDelegation\x12\x0f\n\x07keypath\x18\x01 \x03(\r\x12l\n\x04type\x18\x02 \x01(\x0e\x32^.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Certificate.VoteDelegation.CardanoDRepType\x12\x1a\n\rdrep_credhash\x18\x03 \x01(\x0cH\x00\x88\x01\x01\"^\n\x0f\x43\x61rdanoDRepType\x12\x0c\n\x08KEY_HASH\x10\x00\x12\x0f\n\x0bSCRIPT_HASH\x10\x01\x12\x12\n\x0e\x41LWAYS_ABSTAIN\x10\x02\x12\x18\n\x14\x41LWAYS_NO_CONFIDENCE\x10\x03\x42\x10\n\x0e_drep_credhashB\x06\n\x04\x63\x65rt\x1a,\n\nWithdrawal\x12\x0f\n\x07keypath\x18\x01 \x03(\r\x12\r\n\x05value\x18\x02 \x01(\x04\"\xb9\x01\n\x1e\x43\x61rdanoSignTransactionResponse\x12^\n\x11shelley_witnesses\x18\x01 \x03(\x0b\x32\x43.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionResponse.ShelleyWitness\x1a\x37\n\x0eShelleyWitness\x12\x12\n\npublic_key\x18\x01 \x01(\x0c\x12\x11\n\tsignature\x18\x02 \x01(\x0c\"\xe8\x01\n\x0e\x43\x61rdanoRequest\x12:\n\x05xpubs\x18\x01 \x01(\x0b\x32).shiftcrypto.x1-btc-psbt-firmware.CardanoXpubsRequestH\x00\x12>\n\x07\x61\x64\x64ress\x18\x02 \x01(\x0b\x32+.shiftcrypto.x1-btc-psbt-firmware.CardanoAddressRequestH\x00\x12O\n\x10sign_transaction\x18\x03 \x01(\x0b\x32\x33.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequestH\x00\x42\t\n\x07request\"\xde\x01\n\x0f\x43\x61rdanoResponse\x12;\n\x05xpubs\x18\x01 \x01(\x0b\x32*.shiftcrypto.x1-btc-psbt-firmware.CardanoXpubsResponseH\x00\x12\x30\n\x03pub\x18\x02 \x01(\x0b\x32!.shiftcrypto.x1-btc-psbt-firmware.PubResponseH\x00\x12P\n\x10sign_transaction\x18\x03 \x01(\x0b\x32\x34.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionResponseH\x00\x42\n\n\x08response*8\n\x0e\x43\x61rdanoNetwork\x12\x12\n\x0e\x43\x61rdanoMainnet\x10\x00\x12\x12\n\x0e\x43\x61rdanoTestnet\x10\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rcardano.proto\x12\x14shiftcrypto.x1-btc-psbt-firmware\x1a\x0c\x63ommon.proto\"F\n\x13\x43\x61rdanoXpubsRequest\x12/\n\x08keypaths\x18\x01 \x03(\x0b\x32\x1d.shiftcrypto.x1-btc-psbt-firmware.Keypath\"%\n\x14\x43\x61rdanoXpubsResponse\x12\r\n\x05xpubs\x18\x01 \x03(\x0c\"\x9e\x01\n\x13\x43\x61rdanoScriptConfig\x12\x43\n\x07pkh_skh\x18\x01 \x01(\x0b\x32\x30.shiftcrypto.x1-btc-psbt-firmware.CardanoScriptConfig.PkhSkhH\x00\x1a\x38\n\x06PkhSkh\x12\x17\n\x0fkeypath_payment\x18\x01 \x03(\r\x12\x15\n\rkeypath_stake\x18\x02 \x03(\rB\x08\n\x06\x63onfig\"\xa1\x01\n\x15\x43\x61rdanoAddressRequest\x12\x35\n\x07network\x18\x01 \x01(\x0e\x32$.shiftcrypto.x1-btc-psbt-firmware.CardanoNetwork\x12\x0f\n\x07\x64isplay\x18\x02 \x01(\x08\x12@\n\rscript_config\x18\x03 \x01(\x0b\x32).shiftcrypto.x1-btc-psbt-firmware.CardanoScriptConfig\"\xdf\r\n\x1d\x43\x61rdanoSignTransactionRequest\x12\x35\n\x07network\x18\x01 \x01(\x0e\x32$.shiftcrypto.x1-btc-psbt-firmware.CardanoNetwork\x12I\n\x06inputs\x18\x02 \x03(\x0b\x32\x39.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Input\x12K\n\x07outputs\x18\x03 \x03(\x0b\x32:.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Output\x12\x0b\n\x03\x66\x65\x65\x18\x04 \x01(\x04\x12\x0b\n\x03ttl\x18\x05 \x01(\x04\x12U\n\x0c\x63\x65rtificates\x18\x06 \x03(\x0b\x32?.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Certificate\x12S\n\x0bwithdrawals\x18\x07 \x03(\x0b\x32>.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Withdrawal\x12\x1f\n\x17validity_interval_start\x18\x08 \x01(\x04\x12\x16\n\x0e\x61llow_zero_ttl\x18\t \x01(\x08\x12\x15\n\rtag_cbor_sets\x18\n \x01(\x08\x12\x13\n\x0bnum_outputs\x18\x0b \x01(\r\x1aG\n\x05Input\x12\x0f\n\x07keypath\x18\x01 \x03(\r\x12\x15\n\rprev_out_hash\x18\x02 \x01(\x0c\x12\x16\n\x0eprev_out_index\x18\x03 \x01(\r\x1a\xa1\x01\n\nAssetGroup\x12\x11\n\tpolicy_id\x18\x01 \x01(\x0c\x12T\n\x06tokens\x18\x02 \x03(\x0b\x32\x44.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.AssetGroup.Token\x1a*\n\x05Token\x12\x12\n\nasset_name\x18\x01 \x01(\x0c\x12\r\n\x05value\x18\x02 \x01(\x04\x1a\xe2\x01\n\x06Output\x12\x17\n\x0f\x65ncoded_address\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\x04\x12@\n\rscript_config\x18\x03 \x01(\x0b\x32).shiftcrypto.x1-btc-psbt-firmware.CardanoScriptConfig\x12T\n\x0c\x61sset_groups\x18\x04 \x03(\x0b\x32>.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.AssetGroup\x12\x18\n\x10num_asset_groups\x18\x05 \x01(\r\x1a\xc3\x05\n\x0b\x43\x65rtificate\x12;\n\x12stake_registration\x18\x01 \x01(\x0b\x32\x1d.shiftcrypto.x1-btc-psbt-firmware.KeypathH\x00\x12=\n\x14stake_deregistration\x18\x02 \x01(\x0b\x32\x1d.shiftcrypto.x1-btc-psbt-firmware.KeypathH\x00\x12k\n\x10stake_delegation\x18\x03 \x01(\x0b\x32O.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Certificate.StakeDelegationH\x00\x12i\n\x0fvote_delegation\x18\n \x01(\x0b\x32N.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Certificate.VoteDelegationH\x00\x1a\x38\n\x0fStakeDelegation\x12\x0f\n\x07keypath\x18\x01 \x03(\r\x12\x14\n\x0cpool_keyhash\x18\x02 \x01(\x0c\x1a\x9d\x02\n\x0eVoteDelegation\x12\x0f\n\x07keypath\x18\x01 \x03(\r\x12l\n\x04type\x18\x02 \x01(\x0e\x32^.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Certificate.VoteDelegation.CardanoDRepType\x12\x1a\n\rdrep_credhash\x18\x03 \x01(\x0cH\x00\x88\x01\x01\"^\n\x0f\x43\x61rdanoDRepType\x12\x0c\n\x08KEY_HASH\x10\x00\x12\x0f\n\x0bSCRIPT_HASH\x10\x01\x12\x12\n\x0e\x41LWAYS_ABSTAIN\x10\x02\x12\x18\n\x14\x41LWAYS_NO_CONFIDENCE\x10\x03\x42\x10\n\x0e_drep_credhashB\x06\n\x04\x63\x65rt\x1a,\n\nWithdrawal\x12\x0f\n\x07keypath\x18\x01 \x03(\r\x12\r\n\x05value\x18\x02 \x01(\x04\"\xc9\x01\n\"CardanoSignTransactionNextResponse\x12K\n\x04type\x18\x01 \x01(\x0e\x32=.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionNextResponse.Type\x12\x14\n\x0coutput_index\x18\x02 \x01(\r\x12\x19\n\x11\x61sset_group_index\x18\x03 \x01(\r\"%\n\x04Type\x12\x0b\n\x07OUTPUTS\x10\x00\x12\x10\n\x0c\x41SSET_GROUPS\x10\x01\"s\n$CardanoSignTransactionOutputsRequest\x12K\n\x07outputs\x18\x01 \x03(\x0b\x32:.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.Output\"\x80\x01\n(CardanoSignTransactionAssetGroupsRequest\x12T\n\x0c\x61sset_groups\x18\x01 \x03(\x0b\x32>.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequest.AssetGroup\"\xb9\x01\n\x1e\x43\x61rdanoSignTransactionResponse\x12^\n\x11shelley_witnesses\x18\x01 \x03(\x0b\x32\x43.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionResponse.ShelleyWitness\x1a\x37\n\x0eShelleyWitness\x12\x12\n\npublic_key\x18\x01 \x01(\x0c\x12\x11\n\tsignature\x18\x02 \x01(\x0c\"\x8f\x03\n\x0e\x43\x61rdanoRequest\x12:\n\x05xpubs\x18\x01 \x01(\x0b\x32).shiftcrypto.x1-btc-psbt-firmware.CardanoXpubsRequestH\x00\x12>\n\x07\x61\x64\x64ress\x18\x02 \x01(\x0b\x32+.shiftcrypto.x1-btc-psbt-firmware.CardanoAddressRequestH\x00\x12O\n\x10sign_transaction\x18\x03 \x01(\x0b\x32\x33.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionRequestH\x00\x12M\n\x07outputs\x18\x04 \x01(\x0b\x32:.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionOutputsRequestH\x00\x12V\n\x0c\x61sset_groups\x18\x05 \x01(\x0b\x32>.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionAssetGroupsRequestH\x00\x42\t\n\x07request\"\xb9\x02\n\x0f\x43\x61rdanoResponse\x12;\n\x05xpubs\x18\x01 \x01(\x0b\x32*.shiftcrypto.x1-btc-psbt-firmware.CardanoXpubsResponseH\x00\x12\x30\n\x03pub\x18\x02 \x01(\x0b\x32!.shiftcrypto.x1-btc-psbt-firmware.PubResponseH\x00\x12P\n\x10sign_transaction\x18\x03 \x01(\x0b\x32\x34.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionResponseH\x00\x12Y\n\x15sign_transaction_next\x18\x04 \x01(\x0b\x32\x38.shiftcrypto.x1-btc-psbt-firmware.CardanoSignTransactionNextResponseH\x00\x42\n\n\x08response*8\n\x0e\x43\x61rdanoNetwork\x12\x12\n\x0e\x43\x61rdanoMainnet\x10\x00\x12\x12\n\x0e\x43\x61rdanoTestnet\x10\x01\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'cardano_pb2', globals())
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
-  _CARDANONETWORK._serialized_start=2852
-  _CARDANONETWORK._serialized_end=2908
+  _CARDANONETWORK._serialized_start=3609
+  _CARDANONETWORK._serialized_end=3665
   _CARDANOXPUBSREQUEST._serialized_start=53
   _CARDANOXPUBSREQUEST._serialized_end=123
   _CARDANOXPUBSRESPONSE._serialized_start=125
@@ -34,31 +34,39 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _CARDANOADDRESSREQUEST._serialized_start=326
   _CARDANOADDRESSREQUEST._serialized_end=487
   _CARDANOSIGNTRANSACTIONREQUEST._serialized_start=490
-  _CARDANOSIGNTRANSACTIONREQUEST._serialized_end=2202
-  _CARDANOSIGNTRANSACTIONREQUEST_INPUT._serialized_start=1008
-  _CARDANOSIGNTRANSACTIONREQUEST_INPUT._serialized_end=1079
-  _CARDANOSIGNTRANSACTIONREQUEST_ASSETGROUP._serialized_start=1082
-  _CARDANOSIGNTRANSACTIONREQUEST_ASSETGROUP._serialized_end=1243
-  _CARDANOSIGNTRANSACTIONREQUEST_ASSETGROUP_TOKEN._serialized_start=1201
-  _CARDANOSIGNTRANSACTIONREQUEST_ASSETGROUP_TOKEN._serialized_end=1243
-  _CARDANOSIGNTRANSACTIONREQUEST_OUTPUT._serialized_start=1246
-  _CARDANOSIGNTRANSACTIONREQUEST_OUTPUT._serialized_end=1446
-  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE._serialized_start=1449
-  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE._serialized_end=2156
-  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_STAKEDELEGATION._serialized_start=1804
-  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_STAKEDELEGATION._serialized_end=1860
-  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_VOTEDELEGATION._serialized_start=1863
-  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_VOTEDELEGATION._serialized_end=2148
-  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_VOTEDELEGATION_CARDANODREPTYPE._serialized_start=2036
-  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_VOTEDELEGATION_CARDANODREPTYPE._serialized_end=2130
-  _CARDANOSIGNTRANSACTIONREQUEST_WITHDRAWAL._serialized_start=2158
-  _CARDANOSIGNTRANSACTIONREQUEST_WITHDRAWAL._serialized_end=2202
-  _CARDANOSIGNTRANSACTIONRESPONSE._serialized_start=2205
-  _CARDANOSIGNTRANSACTIONRESPONSE._serialized_end=2390
-  _CARDANOSIGNTRANSACTIONRESPONSE_SHELLEYWITNESS._serialized_start=2335
-  _CARDANOSIGNTRANSACTIONRESPONSE_SHELLEYWITNESS._serialized_end=2390
-  _CARDANOREQUEST._serialized_start=2393
-  _CARDANOREQUEST._serialized_end=2625
-  _CARDANORESPONSE._serialized_start=2628
-  _CARDANORESPONSE._serialized_end=2850
+  _CARDANOSIGNTRANSACTIONREQUEST._serialized_end=2249
+  _CARDANOSIGNTRANSACTIONREQUEST_INPUT._serialized_start=1029
+  _CARDANOSIGNTRANSACTIONREQUEST_INPUT._serialized_end=1100
+  _CARDANOSIGNTRANSACTIONREQUEST_ASSETGROUP._serialized_start=1103
+  _CARDANOSIGNTRANSACTIONREQUEST_ASSETGROUP._serialized_end=1264
+  _CARDANOSIGNTRANSACTIONREQUEST_ASSETGROUP_TOKEN._serialized_start=1222
+  _CARDANOSIGNTRANSACTIONREQUEST_ASSETGROUP_TOKEN._serialized_end=1264
+  _CARDANOSIGNTRANSACTIONREQUEST_OUTPUT._serialized_start=1267
+  _CARDANOSIGNTRANSACTIONREQUEST_OUTPUT._serialized_end=1493
+  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE._serialized_start=1496
+  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE._serialized_end=2203
+  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_STAKEDELEGATION._serialized_start=1851
+  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_STAKEDELEGATION._serialized_end=1907
+  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_VOTEDELEGATION._serialized_start=1910
+  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_VOTEDELEGATION._serialized_end=2195
+  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_VOTEDELEGATION_CARDANODREPTYPE._serialized_start=2083
+  _CARDANOSIGNTRANSACTIONREQUEST_CERTIFICATE_VOTEDELEGATION_CARDANODREPTYPE._serialized_end=2177
+  _CARDANOSIGNTRANSACTIONREQUEST_WITHDRAWAL._serialized_start=2205
+  _CARDANOSIGNTRANSACTIONREQUEST_WITHDRAWAL._serialized_end=2249
+  _CARDANOSIGNTRANSACTIONNEXTRESPONSE._serialized_start=2252
+  _CARDANOSIGNTRANSACTIONNEXTRESPONSE._serialized_end=2453
+  _CARDANOSIGNTRANSACTIONNEXTRESPONSE_TYPE._serialized_start=2416
+  _CARDANOSIGNTRANSACTIONNEXTRESPONSE_TYPE._serialized_end=2453
+  _CARDANOSIGNTRANSACTIONOUTPUTSREQUEST._serialized_start=2455
+  _CARDANOSIGNTRANSACTIONOUTPUTSREQUEST._serialized_end=2570
+  _CARDANOSIGNTRANSACTIONASSETGROUPSREQUEST._serialized_start=2573
+  _CARDANOSIGNTRANSACTIONASSETGROUPSREQUEST._serialized_end=2701
+  _CARDANOSIGNTRANSACTIONRESPONSE._serialized_start=2704
+  _CARDANOSIGNTRANSACTIONRESPONSE._serialized_end=2889
+  _CARDANOSIGNTRANSACTIONRESPONSE_SHELLEYWITNESS._serialized_start=2834
+  _CARDANOSIGNTRANSACTIONRESPONSE_SHELLEYWITNESS._serialized_end=2889
+  _CARDANOREQUEST._serialized_start=2892
+  _CARDANOREQUEST._serialized_end=3291
+  _CARDANORESPONSE._serialized_start=3294
+  _CARDANORESPONSE._serialized_end=3607
 # @@protoc_insertion_point(module_scope)
@@ -105,7 +105,8 @@ global___CardanoAddressRequest = CardanoAddressRequest
 class CardanoSignTransactionRequest(google.protobuf.message.Message):
     """Max allowed transaction size is 16384 bytes according to
     https://github.com/cardano-foundation/CIPs/blob/master/CIP-0009/CIP-0009.md. Unlike with BTC, we
-    can fit the whole request in RAM and don't need to stream.
+    can usually fit the whole request in RAM. Transactions with many outputs or assets can be
+    streamed by setting `num_outputs`, see `CardanoSignTransactionNextResponse`.
 
     See also: https://github.com/input-output-hk/cardano-ledger-specs/blob/d0aa86ded0b973b09b629e5aa62aa1e71364d088/eras/alonzo/test-suite/cddl-files/alonzo.cddl#L50
     """
@@ -163,6 +164,7 @@ class CardanoSignTransactionRequest(google.protobuf.message.Message):
         VALUE_FIELD_NUMBER: builtins.int
         SCRIPT_CONFIG_FIELD_NUMBER: builtins.int
         ASSET_GROUPS_FIELD_NUMBER: builtins.int
+        NUM_ASSET_GROUPS_FIELD_NUMBER: builtins.int
         encoded_address: typing.Text
         value: builtins.int
         @property
@@ -171,15 +173,21 @@ class CardanoSignTransactionRequest(google.protobuf.message.Message):
             pass
         @property
         def asset_groups(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___CardanoSignTransactionRequest.AssetGroup]: ...
+        num_asset_groups: builtins.int
+        """Only if the outputs are streamed: if non-zero, `asset_groups` must be empty, and the device
+        requests this many asset groups in batches.
+        """
+
         def __init__(self,
             *,
             encoded_address: typing.Text = ...,
             value: builtins.int = ...,
             script_config: typing.Optional[global___CardanoScriptConfig] = ...,
             asset_groups: typing.Optional[typing.Iterable[global___CardanoSignTransactionRequest.AssetGroup]] = ...,
+            num_asset_groups: builtins.int = ...,
             ) -> None: ...
         def HasField(self, field_name: typing_extensions.Literal["script_config",b"script_config"]) -> builtins.bool: ...
-        def ClearField(self, field_name: typing_extensions.Literal["asset_groups",b"asset_groups","encoded_address",b"encoded_address","script_config",b"script_config","value",b"value"]) -> None: ...
+        def ClearField(self, field_name: typing_extensions.Literal["asset_groups",b"asset_groups","encoded_address",b"encoded_address","num_asset_groups",b"num_asset_groups","script_config",b"script_config","value",b"value"]) -> None: ...
 
     class Certificate(google.protobuf.message.Message):
         """See https://github.com/IntersectMBO/cardano-ledger/blob/cardano-ledger-conway-1.12.0.0/eras/conway/impl/cddl-files/conway.cddl#L273"""
@@ -283,6 +291,7 @@ class CardanoSignTransactionRequest(google.protobuf.message.Message):
     VALIDITY_INTERVAL_START_FIELD_NUMBER: builtins.int
     ALLOW_ZERO_TTL_FIELD_NUMBER: builtins.int
     TAG_CBOR_SETS_FIELD_NUMBER: builtins.int
+    NUM_OUTPUTS_FIELD_NUMBER: builtins.int
     network: global___CardanoNetwork.ValueType
     @property
     def inputs(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___CardanoSignTransactionRequest.Input]: ...
@@ -303,6 +312,9 @@ class CardanoSignTransactionRequest(google.protobuf.message.Message):
     See https://github.com/IntersectMBO/cardano-ledger/blob/6e2d37cc0f47bd02e89b4ce9f78b59c35c958e96/eras/conway/impl/cddl-files/extra.cddl#L5
     """
 
+    num_outputs: builtins.int
+    """If non-zero, `outputs` must be empty, and the device requests this many outputs in batches."""
+
     def __init__(self,
         *,
         network: global___CardanoNetwork.ValueType = ...,
@@ -315,10 +327,75 @@ class CardanoSignTransactionRequest(google.protobuf.message.Message):
         validity_interval_start: builtins.int = ...,
         allow_zero_ttl: builtins.bool = ...,
         tag_cbor_sets: builtins.bool = ...,
+        num_outputs: builtins.int = ...,
         ) -> None: ...
-    def ClearField(self, field_name: typing_extensions.Literal["allow_zero_ttl",b"allow_zero_ttl","certificates",b"certificates","fee",b"fee","inputs",b"inputs","network",b"network","outputs",b"outputs","tag_cbor_sets",b"tag_cbor_sets","ttl",b"ttl","validity_interval_start",b"validity_interval_start","withdrawals",b"withdrawals"]) -> None: ...
+    def ClearField(self, field_name: typing_extensions.Literal["allow_zero_ttl",b"allow_zero_ttl","certificates",b"certificates","fee",b"fee","inputs",b"inputs","network",b"network","num_outputs",b"num_outputs","outputs",b"outputs","tag_cbor_sets",b"tag_cbor_sets","ttl",b"ttl","validity_interval_start",b"validity_interval_start","withdrawals",b"withdrawals"]) -> None: ...
 global___CardanoSignTransactionRequest = CardanoSignTransactionRequest
 
+class CardanoSignTransactionNextResponse(google.protobuf.message.Message):
+    """Sent by the device instead of the final response while the outputs of a transaction are
+    streamed. The host responds with a batch of one or more items starting at the requested index:
+    `CardanoSignTransactionOutputsRequest` for OUTPUTS, `CardanoSignTransactionAssetGroupsRequest`
+    for ASSET_GROUPS.
+    """
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+    class _Type:
+        ValueType = typing.NewType('ValueType', builtins.int)
+        V: typing_extensions.TypeAlias = ValueType
+    class _TypeEnumTypeWrapper(google.protobuf.internal.enum_type_wrapper._EnumTypeWrapper[CardanoSignTransactionNextResponse._Type.ValueType], builtins.type):
+        DESCRIPTOR: google.protobuf.descriptor.EnumDescriptor
+        OUTPUTS: CardanoSignTransactionNextResponse._Type.ValueType  # 0
+        ASSET_GROUPS: CardanoSignTransactionNextResponse._Type.ValueType  # 1
+    class Type(_Type, metaclass=_TypeEnumTypeWrapper):
+        pass
+
+    OUTPUTS: CardanoSignTransactionNextResponse.Type.ValueType  # 0
+    ASSET_GROUPS: CardanoSignTransactionNextResponse.Type.ValueType  # 1
+
+    TYPE_FIELD_NUMBER: builtins.int
+    OUTPUT_INDEX_FIELD_NUMBER: builtins.int
+    ASSET_GROUP_INDEX_FIELD_NUMBER: builtins.int
+    type: global___CardanoSignTransactionNextResponse.Type.ValueType
+    output_index: builtins.int
+    """Index of the first requested output, or of the output whose asset groups are requested."""
+
+    asset_group_index: builtins.int
+    """Index of the first requested asset group of the output. Only for ASSET_GROUPS."""
+
+    def __init__(self,
+        *,
+        type: global___CardanoSignTransactionNextResponse.Type.ValueType = ...,
+        output_index: builtins.int = ...,
+        asset_group_index: builtins.int = ...,
+        ) -> None: ...
+    def ClearField(self, field_name: typing_extensions.Literal["asset_group_index",b"asset_group_index","output_index",b"output_index","type",b"type"]) -> None: ...
+global___CardanoSignTransactionNextResponse = CardanoSignTransactionNextResponse
+
+class CardanoSignTransactionOutputsRequest(google.protobuf.message.Message):
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+    OUTPUTS_FIELD_NUMBER: builtins.int
+    @property
+    def outputs(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___CardanoSignTransactionRequest.Output]: ...
+    def __init__(self,
+        *,
+        outputs: typing.Optional[typing.Iterable[global___CardanoSignTransactionRequest.Output]] = ...,
+        ) -> None: ...
+    def ClearField(self, field_name: typing_extensions.Literal["outputs",b"outputs"]) -> None: ...
+global___CardanoSignTransactionOutputsRequest = CardanoSignTransactionOutputsRequest
+
+class CardanoSignTransactionAssetGroupsRequest(google.protobuf.message.Message):
+    """Streamed asset groups must be sorted by strictly increasing policy id."""
+    DESCRIPTOR: google.protobuf.descriptor.Descriptor
+    ASSET_GROUPS_FIELD_NUMBER: builtins.int
+    @property
+    def asset_groups(self) -> google.protobuf.internal.containers.RepeatedCompositeFieldContainer[global___CardanoSignTransactionRequest.AssetGroup]: ...
+    def __init__(self,
+        *,
+        asset_groups: typing.Optional[typing.Iterable[global___CardanoSignTransactionRequest.AssetGroup]] = ...,
+        ) -> None: ...
+    def ClearField(self, field_name: typing_extensions.Literal["asset_groups",b"asset_groups"]) -> None: ...
+global___CardanoSignTransactionAssetGroupsRequest = CardanoSignTransactionAssetGroupsRequest
+
 class CardanoSignTransactionResponse(google.protobuf.message.Message):
     DESCRIPTOR: google.protobuf.descriptor.Descriptor
     class ShelleyWitness(google.protobuf.message.Message):
@@ -349,21 +426,29 @@ class CardanoRequest(google.protobuf.message.Message):
     XPUBS_FIELD_NUMBER: builtins.int
     ADDRESS_FIELD_NUMBER: builtins.int
     SIGN_TRANSACTION_FIELD_NUMBER: builtins.int
+    OUTPUTS_FIELD_NUMBER: builtins.int
+    ASSET_GROUPS_FIELD_NUMBER: builtins.int
     @property
     def xpubs(self) -> global___CardanoXpubsRequest: ...
     @property
     def address(self) -> global___CardanoAddressRequest: ...
     @property
     def sign_transaction(self) -> global___CardanoSignTransactionRequest: ...
+    @property
+    def outputs(self) -> global___CardanoSignTransactionOutputsRequest: ...
+    @property
+    def asset_groups(self) -> global___CardanoSignTransactionAssetGroupsRequest: ...
     def __init__(self,
         *,
         xpubs: typing.Optional[global___CardanoXpubsRequest] = ...,
         address: typing.Optional[global___CardanoAddressRequest] = ...,
         sign_transaction: typing.Optional[global___CardanoSignTransactionRequest] = ...,
+        outputs: typing.Optional[global___CardanoSignTransactionOutputsRequest] = ...,
+        asset_groups: typing.Optional[global___CardanoSignTransactionAssetGroupsRequest] = ...,
         ) -> None: ...
-    def HasField(self, field_name: typing_extensions.Literal["address",b"address","request",b"request","sign_transaction",b"sign_transaction","xpubs",b"xpubs"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing_extensions.Literal["address",b"address","request",b"request","sign_transaction",b"sign_transaction","xpubs",b"xpubs"]) -> None: ...
-    def WhichOneof(self, oneof_group: typing_extensions.Literal["request",b"request"]) -> typing.Optional[typing_extensions.Literal["xpubs","address","sign_transaction"]]: ...
+    def HasField(self, field_name: typing_extensions.Literal["address",b"address","asset_groups",b"asset_groups","outputs",b"outputs","request",b"request","sign_transaction",b"sign_transaction","xpubs",b"xpubs"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal["address",b"address","asset_groups",b"asset_groups","outputs",b"outputs","request",b"request","sign_transaction",b"sign_transaction","xpubs",b"xpubs"]) -> None: ...
+    def WhichOneof(self, oneof_group: typing_extensions.Literal["request",b"request"]) -> typing.Optional[typing_extensions.Literal["xpubs","address","sign_transaction","outputs","asset_groups"]]: ...
 global___CardanoRequest = CardanoRequest
 
 class CardanoResponse(google.protobuf.message.Message):
@@ -371,19 +456,23 @@ class CardanoResponse(google.protobuf.message.Message):
     XPUBS_FIELD_NUMBER: builtins.int
     PUB_FIELD_NUMBER: builtins.int
     SIGN_TRANSACTION_FIELD_NUMBER: builtins.int
+    SIGN_TRANSACTION_NEXT_FIELD_NUMBER: builtins.int
     @property
     def xpubs(self) -> global___CardanoXpubsResponse: ...
     @property
     def pub(self) -> common_pb2.PubResponse: ...
     @property
     def sign_transaction(self) -> global___CardanoSignTransactionResponse: ...
+    @property
+    def sign_transaction_next(self) -> global___CardanoSignTransactionNextResponse: ...
     def __init__(self,
         *,
         xpubs: typing.Optional[global___CardanoXpubsResponse] = ...,
         pub: typing.Optional[common_pb2.PubResponse] = ...,
         sign_transaction: typing.Optional[global___CardanoSignTransactionResponse] = ...,
+        sign_transaction_next: typing.Optional[global___CardanoSignTransactionNextResponse] = ...,
         ) -> None: ...
-    def HasField(self, field_name: typing_extensions.Literal["pub",b"pub","response",b"response","sign_transaction",b"sign_transaction","xpubs",b"xpubs"]) -> builtins.bool: ...
-    def ClearField(self, field_name: typing_extensions.Literal["pub",b"pub","response",b"response","sign_transaction",b"sign_transaction","xpubs",b"xpubs"]) -> None: ...
-    def WhichOneof(self, oneof_group: typing_extensions.Literal["response",b"response"]) -> typing.Optional[typing_extensions.Literal["xpubs","pub","sign_transaction"]]: ...
+    def HasField(self, field_name: typing_extensions.Literal["pub",b"pub","response",b"response","sign_transaction",b"sign_transaction","sign_transaction_next",b"sign_transaction_next","xpubs",b"xpubs"]) -> builtins.bool: ...
+    def ClearField(self, field_name: typing_extensions.Literal["pub",b"pub","response",b"response","sign_transaction",b"sign_transaction","sign_transaction_next",b"sign_transaction_next","xpubs",b"xpubs"]) -> None: ...
+    def WhichOneof(self, oneof_group: typing_extensions.Literal["response",b"response"]) -> typing.Optional[typing_extensions.Literal["xpubs","pub","sign_transaction","sign_transaction_next"]]: ...
 global___CardanoResponse = CardanoResponse
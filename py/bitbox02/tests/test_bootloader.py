@@ -0,0 +1,161 @@
+# Copyright 2026 Shift Crypto AG
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Tests for the compressed firmware chunk encoding of the bootloader client."""
+
+import random
+import struct
+import typing
+import unittest
+
+from bitbox02.bitbox02.bootloader import (
+    CHUNK_OP_FILL,
+    CHUNK_OP_INSTALLED,
+    CHUNK_OP_LITERAL,
+    CHUNK_OP_MATCH,
+    CHUNK_SIZE,
+    compress_chunk,
+    index_installed_firmware,
+)
+
+
+def decode_chunk(encoded: bytes, installed: bytes, installed_start: int = 0) -> bytes:
+    """
+    Port of firmware_chunk_decode() in src/bootloader/firmware_chunk.c, with the same checks.
+    Installed firmware before `installed_start` counts as overwritten, like on the device.
+    """
+    out = bytearray()
+    pos = 0
+    while pos < len(encoded):
+        if len(encoded) - pos < 3:
+            raise ValueError("truncated op")
+        op, length = struct.unpack_from("<BH", encoded, pos)
+        pos += 3
+        if length > CHUNK_SIZE - len(out):
+            raise ValueError("output too long")
+        if op == CHUNK_OP_LITERAL:
+            if len(encoded) - pos < length:
+                raise ValueError("truncated literal")
+            out.extend(encoded[pos : pos + length])
+            pos += length
+        elif op == CHUNK_OP_FILL:
+            if len(encoded) - pos < 1:
+                raise ValueError("truncated fill")
+            out.extend(encoded[pos : pos + 1] * length)
+            pos += 1
+        elif op == CHUNK_OP_MATCH:
+            if len(encoded) - pos < 2:
+                raise ValueError("truncated match")
+            (distance,) = struct.unpack_from("<H", encoded, pos)
+            pos += 2
+            if distance == 0 or distance > len(out):
+                raise ValueError("invalid match distance")
+            # Byte by byte, as the source may overlap with the bytes being written.
+            for _ in range(length):
+                out.append(out[-distance])
+        elif op == CHUNK_OP_INSTALLED:
+            if len(encoded) - pos < 4:
+                raise ValueError("truncated installed")
+            (offset,) = struct.unpack_from("<I", encoded, pos)
+            pos += 4
+            if offset < installed_start or offset + length > len(installed):
+                raise ValueError("installed firmware not available")
+            out.extend(installed[offset : offset + length])
+        else:
+            raise ValueError("invalid op")
+    if len(out) != CHUNK_SIZE:
+        raise ValueError("output too short")
+    return bytes(out)
+
+
+def _random_bytes(rng: random.Random, size: int) -> bytes:
+    return bytes(rng.getrandbits(8) for _ in range(size))
+
+
+def _firmware(rng: random.Random, size: int) -> bytes:
+    """Random code-like data: short random runs, repeated sequences and padding."""
+    out = bytearray()
+    while len(out) < size:
+        kind = rng.randrange(3)
+        if kind == 0:
+            out.extend(_random_bytes(rng, rng.randrange(1, 40)))
+        elif kind == 1 and len(out) > 64:
+            start = rng.randrange(len(out) - 32)
+            out.extend(out[start : start + rng.randrange(6, 32)])
+        else:
+            out.extend(bytes([rng.choice((0x00, 0xFF))]) * rng.randrange(1, 80))
+    return bytes(out[:size])
+
+
+class TestCompressChunk(unittest.TestCase):
+    def _roundtrip(
+        self,
+        chunk: bytes,
+        installed: typing.Optional[bytes] = None,
+        installed_start: int = 0,
+    ) -> bytes:
+        index = index_installed_firmware(installed) if installed is not None else None
+        encoded = compress_chunk(chunk, installed, index, installed_start)
+        self.assertEqual(decode_chunk(encoded, installed or b"", installed_start), chunk)
+        return encoded
+
+    def test_decoder_format(self) -> None:
+        # The vector of _test_firmware_chunk_decode() in test/unit-test/test_firmware_chunk.c.
+        installed = bytes((i * 7) & 0xFF for i in range(2 * CHUNK_SIZE))
+        rest = CHUNK_SIZE - 114
+        offset = CHUNK_SIZE + 1
+        encoded = (
+            struct.pack("<BH", CHUNK_OP_LITERAL, 4)
+            + b"\x01\x02\x03\x04"
+            + struct.pack("<BHH", CHUNK_OP_MATCH, 10, 4)
+            + struct.pack("<BHB", CHUNK_OP_FILL, 100, 0xFF)
+            + struct.pack("<BHI", CHUNK_OP_INSTALLED, rest, offset)
+        )
+        decoded = decode_chunk(encoded, installed)
+        self.assertEqual(decoded[:14], b"\x01\x02\x03\x04" * 3 + b"\x01\x02")
+        self.assertEqual(decoded[14:114], b"\xff" * 100)
+        self.assertEqual(decoded[114:], installed[offset : offset + rest])
+        with self.assertRaises(ValueError):
+            decode_chunk(encoded[:-1], installed)
+        with self.assertRaises(ValueError):
+            decode_chunk(encoded[:-7], installed)
+
+    def test_roundtrip(self) -> None:
+        rng = random.Random(0)
+        for _ in range(20):
+            self._roundtrip(_firmware(rng, CHUNK_SIZE))
+        self._roundtrip(_random_bytes(rng, CHUNK_SIZE))
+        self.assertLess(len(self._roundtrip(b"\xff" * CHUNK_SIZE)), 10)
+        self.assertLess(len(self._roundtrip(b"\x01\x02\x03" * 1365 + b"\x01")), 20)
+
+    def test_roundtrip_delta(self) -> None:
+        rng = random.Random(1)
+        installed = _firmware(rng, 8 * CHUNK_SIZE)
+        for chunk_num in range(8):
+            start = chunk_num * CHUNK_SIZE
+            # The new firmware changes a few bytes and moves code around.
+            chunk = bytearray(installed[start : start + CHUNK_SIZE])
+            for _ in range(10):
+                chunk[rng.randrange(CHUNK_SIZE)] = rng.randrange(256)
+            shift = rng.randrange(1, 100)
+            chunk = chunk[shift:] + installed[start : start + shift]
+            encoded = self._roundtrip(bytes(chunk), installed, start)
+            self.assertLess(len(encoded), CHUNK_SIZE // 10)
+
+    def test_invalid_length(self) -> None:
+        with self.assertRaises(ValueError):
+            compress_chunk(b"\x00" * (CHUNK_SIZE - 1))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -14,6 +14,7 @@
 
 #include "bootloader.h"
 #include "bootloader_version.h"
+#include "firmware_chunk.h"
 #include "mpu_regions.h"
 #include "pac_ext.h"
 
@@ -26,6 +27,7 @@
 #include <flags.h>
 #include <memory/memory_shared.h>
 #include <memory/nvmctrl.h>
+#include <peripheral_clk_config.h>
 #include <pukcc/curve_p256.h>
 #include <screen.h>
 #include <ui/components/ui_images.h>
@@ -55,6 +57,9 @@
 // The command must include the chunk number in order to be written to the
 // correct FLASH location.
 #define OP_WRITE_FIRMWARE_CHUNK ((uint8_t)'w') /* 0x77 */
+// OP_WRITE_FIRMWARE_CHUNK_COMPRESSED - Like OP_WRITE_FIRMWARE_CHUNK, but the chunk is encoded as
+// described in firmware_chunk.h, optionally referencing the currently installed firmware.
+#define OP_WRITE_FIRMWARE_CHUNK_COMPRESSED ((uint8_t)'z') /* 0x7A */
 // OP_WRITE_SIG_DATA - Write the firmware's signature data, which is used
 // for firmware verification.
 #define OP_WRITE_SIG_DATA ((uint8_t)'s') /* 0x73 */
@@ -70,6 +75,9 @@
 #define OP_SET_SHOW_FIRMWARE_HASH ((uint8_t)'H') /* 0x4A */
 // OP_HARDWARE - Return the secure chip variant.
 #define OP_HARDWARE ((uint8_t)'W') /* 0x57 */
+// OP_BOOT_TIME - Return the time it took to enter the bootloader, and the time the firmware
+// verification takes, measured on request. Fails if the installed firmware is not valid.
+#define OP_BOOT_TIME ((uint8_t)'t') /* 0x74 */
 
 // API return codes
 #define OP_STATUS_OK ((uint8_t)0)
@@ -92,7 +100,6 @@ COMPILER_ALIGNED(128)
 static struct sha_context _pukcc_sha256_context;
 COMPILER_PACK_RESET()
 
-#define FIRMWARE_CHUNK_LEN (8U * FLASH_PAGE_SIZE) // 4kB
 #define FIRMWARE_MAX_NUM_CHUNKS \
     (FLASH_APP_LEN / FIRMWARE_CHUNK_LEN) // app len must be a multiple of chunk len
 #if (FIRMWARE_MAX_NUM_CHUNKS > UINT8_MAX)
@@ -113,25 +120,18 @@ static_assert(sizeof(((boot_data_t*)0)->fields) <= FLASH_BOOTDATA_LEN, "boot_dat
 
 static bool _loading_ready = false;
 static uint8_t _firmware_num_chunks = 0;
+// Chunks written since the last erase. Their previous contents can't be referenced anymore by
+// compressed chunks.
+static uint8_t _chunks_written[(FIRMWARE_MAX_NUM_CHUNKS + 7) / 8] = {0};
 // Indicates whether the whole app flash contains only 0xFF.
 // This controls bootloader text messages on the screen.
 // The value is computed at bootloader enter.
 static bool _is_app_flash_empty = false;
 
-// A "bare" firmware hash where all app flash sections are empty.
-// Bare meaning the hash is computed in the same way as _firmware_hash except
-// the firmware version is omitted.
-// If FLASH_APP_LEN is changed, recompute with either a shell command:
-//     printf '%884736s' | tr ' ' '\377' | openssl sha256 -binary | openssl sha256 -hex
-// or python:
-//     hashlib.sha256(hashlib.sha256(b'\xff' * 884736).digest()).hexdigest()
-static const uint8_t _empty_bare_flash_hash[SHA256_DIGEST_LENGTH] = {
-    0xbf, 0x71, 0x80, 0xc1, 0x23, 0xdf, 0xb5, 0x96, 0x1d, 0x93, 0xcd, 0x5f, 0xd9, 0x8a, 0xa4, 0x35,
-    0x00, 0xb8, 0xaf, 0x3a, 0x79, 0xf8, 0xc6, 0x56, 0x4a, 0x9b, 0x02, 0xe1, 0x8a, 0xb8, 0x21, 0xae,
-};
-#if FLASH_APP_LEN != 884736
-#error "FLASH_APP_LEN changed; recompute _empty_bare_flash_hash"
-#endif
+// Time from entering the bootloader until it was ready to receive commands, in microseconds. Only
+// the init and firmware verification work is counted, not the time spent showing the screen or
+// waiting for the user, which would also overflow the cycle counter after ~35s.
+static uint32_t _boot_time_us = 0;
 
 // clang-format off
 #if PRODUCT_BITBOX_BTCONLY == 1
@@ -368,16 +368,43 @@ static void _render_hash(const char* title, const uint8_t* hash)
     _render_default_screen();
 }
 
-// Sets _is_app_flash_empty by computing a "bare" hash, identical to _firmware_hash
-// except omitting the firmware version.
+// Sets _is_app_flash_empty. Stops at the first word that is not erased, so this is only a full
+// pass over the app flash if it is actually empty.
 static void _compute_is_app_flash_empty(void)
 {
-    uint8_t hash[SHA256_DIGEST_LENGTH];
-    sha_sync_sha256_start(&HASH_ALGORITHM_0, &_pukcc_sha256_context, false);
-    sha_sync_sha256_update(&HASH_ALGORITHM_0, (const uint8_t*)FLASH_APP_START, FLASH_APP_LEN);
-    sha_sync_sha256_finish(&HASH_ALGORITHM_0, hash);
-    pukcc_sha256_compute(hash, SHA256_DIGEST_LENGTH, hash);
-    _is_app_flash_empty = MEMEQ(hash, _empty_bare_flash_hash, sizeof(_empty_bare_flash_hash));
+    const volatile uint32_t* app = (const volatile uint32_t*)FLASH_APP_START;
+    for (size_t i = 0; i < FLASH_APP_LEN / sizeof(uint32_t); i++) {
+        if (app[i] != 0xFFFFFFFF) {
+            _is_app_flash_empty = false;
+            return;
+        }
+    }
+    _is_app_flash_empty = true;
+}
+
+// Starts the CPU cycle counter, used to measure durations.
+static void _cycle_counter_start(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+// Stops the cycle counter while the screen is updated or the user is waiting, so that this time is
+// not counted in the boot time.
+static void _cycle_counter_pause(void)
+{
+    DWT->CTRL &= ~DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static void _cycle_counter_resume(void)
+{
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t _cycles_to_us(uint32_t cycles)
+{
+    return cycles / (CONF_CPU_FREQUENCY / 1000000);
 }
 
 static size_t _report_status(uint8_t status, uint8_t* output)
@@ -386,23 +413,30 @@ static size_t _report_status(uint8_t status, uint8_t* output)
     return BOOT_OP_LEN;
 }
 
-static size_t _api_write_chunk(const uint8_t* buf, uint8_t chunknum, uint8_t* output)
+static bool _chunk_written(uint32_t chunknum)
 {
-    if (!_loading_ready) {
-        return _report_status(OP_STATUS_ERR_LOAD_FLAG, output);
-    }
-    _loading_ready = false;
+    return (_chunks_written[chunknum / 8] >> (chunknum % 8)) & 1;
+}
 
-    if (BOOT_OP_LEN + FIRMWARE_CHUNK_LEN > USB_DATA_MAX_LEN) {
-        return _report_status(OP_STATUS_ERR_MACRO, output);
+// Source of FIRMWARE_CHUNK_OP_INSTALLED. Only the contents of chunks which were not yet
+// overwritten since the erase can be referenced.
+static const uint8_t* _installed_firmware(uint32_t offset, uint32_t len)
+{
+    if (len == 0 || offset > FLASH_APP_LEN || len > FLASH_APP_LEN - offset) {
+        return NULL;
     }
-
-    // The second is redundant, as _firmware_num_chunks <=
-    // FIRMWARE_MAX_NUM_CHUNKS.
-    if (chunknum > _firmware_num_chunks - 1 || chunknum > FIRMWARE_MAX_NUM_CHUNKS - 1) {
-        return _report_status(OP_STATUS_ERR_LEN, output);
+    const uint32_t last_chunk = (offset + len - 1) / FIRMWARE_CHUNK_LEN;
+    for (uint32_t chunk = offset / FIRMWARE_CHUNK_LEN; chunk <= last_chunk; chunk++) {
+        if (_chunk_written(chunk)) {
+            return NULL;
+        }
     }
+    return (const uint8_t*)(FLASH_APP_START + offset);
+}
 
+// Writes one FIRMWARE_CHUNK_LEN chunk unless the flash contains it already, and verifies it.
+static size_t _flash_chunk(const uint8_t* buf, uint8_t chunknum, uint8_t* output)
+{
     if (MEMEQ(
             (const void*)(FLASH_APP_START + (chunknum * FIRMWARE_CHUNK_LEN)),
             buf,
@@ -411,6 +445,8 @@ static size_t _api_write_chunk(const uint8_t* buf, uint8_t chunknum, uint8_t* ou
         return _report_status(OP_STATUS_OK, output);
     }
 
+    // Marked before writing, as a failed write can leave the previous contents partially erased.
+    _chunks_written[chunknum / 8] |= 1U << (chunknum % 8);
     // Erase is handled inside of flash_write
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdiscarded-qualifiers"
@@ -433,6 +469,57 @@ static size_t _api_write_chunk(const uint8_t* buf, uint8_t chunknum, uint8_t* ou
     return len;
 }
 
+// Checks whether the chunk can be written and clears the loading flag until it is written.
+static bool _begin_write_chunk(uint8_t chunknum, uint8_t* output)
+{
+    if (!_loading_ready) {
+        _report_status(OP_STATUS_ERR_LOAD_FLAG, output);
+        return false;
+    }
+    _loading_ready = false;
+
+    if (BOOT_OP_LEN + FIRMWARE_CHUNK_LEN > USB_DATA_MAX_LEN) {
+        _report_status(OP_STATUS_ERR_MACRO, output);
+        return false;
+    }
+
+    // The second is redundant, as _firmware_num_chunks <=
+    // FIRMWARE_MAX_NUM_CHUNKS.
+    if (chunknum > _firmware_num_chunks - 1 || chunknum > FIRMWARE_MAX_NUM_CHUNKS - 1) {
+        _report_status(OP_STATUS_ERR_LEN, output);
+        return false;
+    }
+    return true;
+}
+
+static size_t _api_write_chunk(const uint8_t* buf, uint8_t chunknum, uint8_t* output)
+{
+    if (!_begin_write_chunk(chunknum, output)) {
+        return BOOT_OP_LEN;
+    }
+    return _flash_chunk(buf, chunknum, output);
+}
+
+/**
+ * Decodes a compressed chunk into RAM and then writes it exactly like an uncompressed chunk, so
+ * the verification after writing and the signature check of the final firmware are unaffected.
+ */
+static size_t _api_write_chunk_compressed(
+    const uint8_t* buf,
+    size_t buf_len,
+    uint8_t chunknum,
+    uint8_t* output)
+{
+    static uint8_t chunk[FIRMWARE_CHUNK_LEN];
+    if (!_begin_write_chunk(chunknum, output)) {
+        return BOOT_OP_LEN;
+    }
+    if (!firmware_chunk_decode(buf, buf_len, _installed_firmware, chunk)) {
+        return _report_status(OP_STATUS_ERR, output);
+    }
+    return _flash_chunk(chunk, chunknum, output);
+}
+
 /**
  * This function erases only the padding bytes, if not already erased. Other
  * bytes get erased and written when writing the firmware chunks.
@@ -449,6 +536,7 @@ static size_t _api_firmware_erase(uint8_t firmware_num_chunks, uint8_t* output)
         _render_progress(0);
     }
     _loading_ready = false;
+    memset(_chunks_written, 0, sizeof(_chunks_written));
     for (uint32_t i = 0; i < (uint32_t)FLASH_APP_PAGE_NUM; i += FLASH_REGION_PAGE_NUM) {
         if (flash_unlock(&FLASH_0, FLASH_APP_START + i * FLASH_PAGE_SIZE, FLASH_REGION_PAGE_NUM) !=
             FLASH_REGION_PAGE_NUM) {
@@ -553,19 +641,11 @@ static void _maybe_show_hash(void)
 }
 
 /*
- * Check the if the signatures of the firmware hash are valid.
- * If jump = true and M signatures are valid, jump to the firmware app.
+ * Check if the signatures of the signing keys and of the firmware hash are valid. Has no side
+ * effects.
  */
-static secbool_u32 _firmware_verified_jump(const boot_data_t* data, secbool_u32 jump)
+static secbool_u32 _firmware_verified(const boot_data_t* data)
 {
-    if (jump) {
-        _maybe_show_hash();
-    }
-
-    for (uint32_t i = 0; i < (uint32_t)FLASH_APP_PAGE_NUM; i += FLASH_REGION_PAGE_NUM) {
-        flash_lock(&FLASH_0, FLASH_APP_START + i * FLASH_PAGE_SIZE, FLASH_REGION_PAGE_NUM);
-    }
-
     // Verify the firmware, signed by the signing keys
     if (_pubkeys_verified(data) != sectrue_u32) {
         return secfalse_u32;
@@ -594,14 +674,36 @@ static secbool_u32 _firmware_verified_jump(const boot_data_t* data, secbool_u32
     }
 
     if (valid >= BOOT_FIRMWARE_SIG_M) {
-        if (jump == sectrue_u32) {
-            _binary_exec(); /* no return */
-        }
         return sectrue_u32;
     }
     return secfalse_u32;
 }
 
+/*
+ * Lock the app flash and check if the signatures of the firmware hash are valid.
+ * If jump = true and M signatures are valid, jump to the firmware app.
+ */
+static secbool_u32 _firmware_verified_jump(const boot_data_t* data, secbool_u32 jump)
+{
+    if (jump) {
+        _cycle_counter_pause();
+        _maybe_show_hash();
+        _cycle_counter_resume();
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)FLASH_APP_PAGE_NUM; i += FLASH_REGION_PAGE_NUM) {
+        flash_lock(&FLASH_0, FLASH_APP_START + i * FLASH_PAGE_SIZE, FLASH_REGION_PAGE_NUM);
+    }
+
+    if (_firmware_verified(data) != sectrue_u32) {
+        return secfalse_u32;
+    }
+    if (jump == sectrue_u32) {
+        _binary_exec(); /* no return */
+    }
+    return sectrue_u32;
+}
+
 static uint8_t _write_chunk(uint32_t address, const uint8_t* data)
 {
     const uint32_t lock_size = FLASH_ERASE_PAGE_NUM * FLASH_PAGE_SIZE;
@@ -777,6 +879,26 @@ static size_t _api_screen_rotate(uint8_t* output)
     return _report_status(OP_STATUS_OK, output);
 }
 
+/*
+ * output filled with the boot time (uint32, microseconds) | firmware verification time (uint32,
+ * microseconds). Fails if the installed firmware is not valid, as the verification then bails out
+ * early. The app flash is not locked, so this can be called during an upload.
+ */
+static size_t _api_boot_time(uint8_t* output)
+{
+    const boot_data_t* data = (const boot_data_t*)FLASH_BOOTDATA_START;
+    const uint32_t start = DWT->CYCCNT;
+    const secbool_u32 verified = _firmware_verified(data);
+    const uint32_t verify_time_us = _cycles_to_us(DWT->CYCCNT - start);
+    if (verified != sectrue_u32) {
+        return _report_status(OP_STATUS_ERR, output);
+    }
+    memcpy(output + BOOT_OP_LEN, &_boot_time_us, sizeof(_boot_time_us));
+    memcpy(output + BOOT_OP_LEN + sizeof(uint32_t), &verify_time_us, sizeof(verify_time_us));
+    _report_status(OP_STATUS_OK, output);
+    return BOOT_OP_LEN + sizeof(uint32_t) * 2;
+}
+
 static size_t _api_hardware(uint8_t* output)
 {
     uint8_t type = 0;
@@ -787,7 +909,11 @@ static size_t _api_hardware(uint8_t* output)
     return _report_status(OP_STATUS_OK, output) + 1;
 }
 
-static size_t _api_command(const uint8_t* input, uint8_t* output, const size_t max_out_len)
+static size_t _api_command(
+    const uint8_t* input,
+    size_t input_len,
+    uint8_t* output,
+    const size_t max_out_len)
 {
     memset(output, 0, max_out_len);
     output[0] = input[0]; // OP_CODE
@@ -824,6 +950,22 @@ static size_t _api_command(const uint8_t* input, uint8_t* output, const size_t m
         }
         break;
     }
+    case OP_WRITE_FIRMWARE_CHUNK_COMPRESSED: {
+        if (input_len < 2) {
+            len = _report_status(OP_STATUS_ERR_LEN, output);
+            _loading_ready = false;
+            _render_default_screen();
+            break;
+        }
+        uint8_t chunk_num = input[1];
+        len = _api_write_chunk_compressed(input + 2, input_len - 2, chunk_num, output);
+        if (output[1] != OP_STATUS_OK) {
+            _render_default_screen();
+        } else {
+            _render_progress((float)chunk_num / (float)(_firmware_num_chunks - 1));
+        }
+        break;
+    }
     case OP_WRITE_SIG_DATA:
         len = _api_write_sig_data(input + 1, output);
         break;
@@ -833,6 +975,9 @@ static size_t _api_command(const uint8_t* input, uint8_t* output, const size_t m
     case OP_HARDWARE:
         len = _api_hardware(output);
         break;
+    case OP_BOOT_TIME:
+        len = _api_boot_time(output);
+        break;
     default:
         len = _report_status(OP_STATUS_ERR_INVALID_CMD, output);
         _loading_ready = false;
@@ -847,7 +992,8 @@ static size_t _api_command(const uint8_t* input, uint8_t* output, const size_t m
 
 static void _api_msg(const Packet* in_packet, Packet* out_packet, const size_t max_out_len)
 {
-    size_t len = _api_command(in_packet->data_addr, out_packet->data_addr, max_out_len);
+    size_t len = _api_command(
+        in_packet->data_addr, in_packet->len, out_packet->data_addr, max_out_len);
     out_packet->len = len;
 }
 
@@ -961,6 +1107,7 @@ static bool _devdevice_enter(secbool_u32 firmware_verified)
 
 void bootloader_jump(void)
 {
+    _cycle_counter_start();
     boot_data_t bootdata;
     chunk_shared_t shared_data;
 
@@ -979,21 +1126,30 @@ void bootloader_jump(void)
 
     if (shared_data.fields.auto_enter != sectrue_u8) {
 #ifdef BOOTLOADER_DEVDEVICE
-        if (!_devdevice_enter(_firmware_verified_jump(&bootdata, secfalse_u32))) {
+        const secbool_u32 firmware_verified = _firmware_verified_jump(&bootdata, secfalse_u32);
+        _cycle_counter_pause();
+        if (!_devdevice_enter(firmware_verified)) {
             _binary_exec();
             /* no return */
         }
+        _cycle_counter_resume();
 #else
         _firmware_verified_jump(&bootdata, sectrue_u32); // no return if firmware is valid
+        _cycle_counter_pause();
         _render_message("Firmware\ninvalid\n \nEntering bootloader", 3000);
+        _cycle_counter_resume();
 #endif
     }
 
     // App not entered. Start USB API to receive boot commands
     util_log("Not jumping to firmware");
     _compute_is_app_flash_empty();
+    _cycle_counter_pause();
     _render_default_screen();
-    if (usb_start(_api_setup) != ERR_NONE) {
+    _cycle_counter_resume();
+    const int32_t usb_result = usb_start(_api_setup);
+    _boot_time_us = _cycles_to_us(DWT->CYCCNT);
+    if (usb_result != ERR_NONE) {
         _render_message("Failed to initialize USB", 0);
     }
 }
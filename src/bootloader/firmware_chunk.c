@@ -0,0 +1,95 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "firmware_chunk.h"
+
+#include <string.h>
+
+static uint32_t _read_le(const uint8_t* in, size_t num_bytes)
+{
+    uint32_t result = 0;
+    for (size_t i = 0; i < num_bytes; i++) {
+        result |= (uint32_t)in[i] << (8 * i);
+    }
+    return result;
+}
+
+bool firmware_chunk_decode(
+    const uint8_t* in,
+    size_t in_len,
+    firmware_chunk_installed_fn installed,
+    uint8_t* out)
+{
+    size_t in_pos = 0;
+    size_t out_pos = 0;
+    while (in_pos < in_len) {
+        if (in_len - in_pos < 3) {
+            return false;
+        }
+        const uint8_t op = in[in_pos];
+        const size_t len = _read_le(&in[in_pos + 1], 2);
+        in_pos += 3;
+        if (len > FIRMWARE_CHUNK_LEN - out_pos) {
+            return false;
+        }
+        switch (op) {
+        case FIRMWARE_CHUNK_OP_LITERAL:
+            if (in_len - in_pos < len) {
+                return false;
+            }
+            memcpy(&out[out_pos], &in[in_pos], len);
+            in_pos += len;
+            break;
+        case FIRMWARE_CHUNK_OP_FILL:
+            if (in_len - in_pos < 1) {
+                return false;
+            }
+            memset(&out[out_pos], in[in_pos], len);
+            in_pos += 1;
+            break;
+        case FIRMWARE_CHUNK_OP_MATCH: {
+            if (in_len - in_pos < 2) {
+                return false;
+            }
+            const size_t distance = _read_le(&in[in_pos], 2);
+            in_pos += 2;
+            if (distance == 0 || distance > out_pos) {
+                return false;
+            }
+            // Byte by byte, as the source may overlap with the bytes being written.
+            for (size_t i = 0; i < len; i++) {
+                out[out_pos + i] = out[out_pos + i - distance];
+            }
+            break;
+        }
+        case FIRMWARE_CHUNK_OP_INSTALLED: {
+            if (in_len - in_pos < 4) {
+                return false;
+            }
+            const uint32_t offset = _read_le(&in[in_pos], 4);
+            in_pos += 4;
+            const uint8_t* source = installed(offset, (uint32_t)len);
+            if (source == NULL) {
+                return false;
+            }
+            memcpy(&out[out_pos], source, len);
+            break;
+        }
+        default:
+            return false;
+        }
+        out_pos += len;
+    }
+    return out_pos == FIRMWARE_CHUNK_LEN;
+}
@@ -0,0 +1,62 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FIRMWARE_CHUNK_H_
+#define _FIRMWARE_CHUNK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <compiler_util.h>
+#include <flags.h>
+
+#define FIRMWARE_CHUNK_LEN (8U * FLASH_PAGE_SIZE) // 4kB
+
+// Encoding of compressed firmware chunks: a sequence of ops, each starting with the op code and a
+// little endian uint16 length (number of output bytes), followed by the op arguments. The ops must
+// produce exactly FIRMWARE_CHUNK_LEN bytes.
+//
+// FIRMWARE_CHUNK_OP_LITERAL - followed by `length` bytes which are copied to the output.
+#define FIRMWARE_CHUNK_OP_LITERAL ((uint8_t)0x00)
+// FIRMWARE_CHUNK_OP_FILL - followed by one byte which is repeated `length` times.
+#define FIRMWARE_CHUNK_OP_FILL ((uint8_t)0x01)
+// FIRMWARE_CHUNK_OP_MATCH - followed by a little endian uint16 distance. Copies `length` bytes
+// starting `distance` bytes back in the output. The ranges may overlap.
+#define FIRMWARE_CHUNK_OP_MATCH ((uint8_t)0x02)
+// FIRMWARE_CHUNK_OP_INSTALLED - followed by a little endian uint32 offset into the app flash.
+// Copies `length` bytes of the currently installed firmware, for delta updates.
+#define FIRMWARE_CHUNK_OP_INSTALLED ((uint8_t)0x03)
+
+/**
+ * Returns the `len` bytes of the installed firmware at `offset` from the start of the app flash,
+ * or NULL if they are not available, e.g. because they have already been overwritten.
+ */
+typedef const uint8_t* (*firmware_chunk_installed_fn)(uint32_t offset, uint32_t len);
+
+/**
+ * Decodes a compressed firmware chunk.
+ * @param[in] in encoded chunk, see FIRMWARE_CHUNK_OP_*.
+ * @param[in] in_len length of `in`.
+ * @param[in] installed provides the data for FIRMWARE_CHUNK_OP_INSTALLED.
+ * @param[out] out must be FIRMWARE_CHUNK_LEN bytes.
+ * @return true if `in` is a valid encoding of exactly FIRMWARE_CHUNK_LEN bytes.
+ */
+USE_RESULT bool firmware_chunk_decode(
+    const uint8_t* in,
+    size_t in_len,
+    firmware_chunk_installed_fn installed,
+    uint8_t* out);
+
+#endif
@@ -57,7 +57,6 @@ int main(void)
 #endif
     bootloader_jump();
 
-    const uint8_t* hww_data = NULL;
     uint8_t hww_frame[USB_REPORT_SIZE] = {0};
 
     // If did not jump to firmware code, begin USB processing
@@ -65,15 +64,8 @@ int main(void)
         if (hid_hww_read(&hww_frame[0])) {
             usb_packet_process((const USB_FRAME*)hww_frame);
         }
-        if (!hww_data) {
-            hww_data = queue_pull(queue_hww_queue());
-        }
-        if (hww_data) {
-            if (hid_hww_write_poll(hww_data)) {
-                hww_data = NULL;
-            }
-        }
         usb_processing_process(usb_processing_hww());
+        hid_hww_write_queued();
     }
     return 0;
 }
@@ -22,6 +22,7 @@
 #include "qtouch.h"
 #include "screen.h"
 #include "ui/screen_stack.h"
+#include <rust/rust.h>
 
 uint32_t __stack_chk_guard = 0;
 
@@ -35,6 +36,7 @@ int main(void)
     screen_splash();
     qtouch_init();
     common_main();
+    rust_secp256k1_init();
     x1-btc-psbt-firmware_smarteeprom_init();
     firmware_main_loop();
     return 0;
@@ -17,6 +17,7 @@
 #include "hardfault.h"
 #include "hid_hww.h"
 #include "hww.h"
+#include "main_loop_event.h"
 #include "touch/gestures.h"
 #include "ui/screen_process.h"
 #include "ui/screen_stack.h"
@@ -32,55 +33,58 @@
 #include "usb/class/hid/u2f/hid_u2f.h"
 #endif
 
+/**
+ * Starts sending the frames queued so far. Once started, the frames are sent back to back from the
+ * USB interrupt.
+ */
+static void _write_queued(void)
+{
+    hid_hww_write_queued();
+#if APP_U2F == 1
+    hid_u2f_write_queued();
+#endif
+}
+
 void firmware_main_loop(void)
 {
     // This starts the async orientation screen workflow, which is processed by the loop below.
     orientation_screen();
+    screen_process_init();
 
-    const uint8_t* hww_data = NULL;
     uint8_t hww_frame[USB_REPORT_SIZE] = {0};
 
 #if APP_U2F == 1
     u2f_packet_init();
-    const uint8_t* u2f_data = NULL;
     uint8_t u2f_frame[USB_REPORT_SIZE] = {0};
 #endif
 
     while (1) {
+        // Work is dispatched in priority order: USB I/O, USB processing, application level
+        // processing, UI and finally the Rust workflows. Afterwards, the CPU sleeps until the
+        // next interrupt if no event or wake-up was posted in the meantime.
+        const uint32_t events = main_loop_event_take();
+        bool received = false;
+
         // Do USB I/O
-        if (!hww_data) {
-            hww_data = queue_pull(queue_hww_queue());
-        }
 #if APP_U2F == 1
         // Generate timeout packets
-        uint32_t timeout_cid;
-        while (u2f_packet_timeout_get(&timeout_cid)) {
-            u2f_packet_timeout(timeout_cid);
-        }
-        if (!u2f_data) {
-            u2f_data = queue_pull(queue_u2f_queue());
+        if (events & MAIN_LOOP_EVENT_TIMER) {
+            uint32_t timeout_cid;
+            while (u2f_packet_timeout_get(&timeout_cid)) {
+                u2f_packet_timeout(timeout_cid);
+            }
         }
 #endif
-        // Only read new messages if we have nothing to send
-        if (!hww_data && hid_hww_read(&hww_frame[0])) {
+        // Reading and writing use separate endpoints and buffers, so new frames are read while a
+        // reply is still being sent.
+        if (hid_hww_read(&hww_frame[0])) {
             usb_packet_process((const USB_FRAME*)hww_frame);
+            received = true;
         }
 #if APP_U2F == 1
-        if (!u2f_data && hid_u2f_read(&u2f_frame[0])) {
+        if (hid_u2f_read(&u2f_frame[0])) {
             u2f_packet_process((const USB_FRAME*)u2f_frame);
-        }
-#endif
-
-        if (hww_data) {
-            if (hid_hww_write_poll(hww_data)) {
-                hww_data = NULL;
-            }
-        }
-#if APP_U2F == 1
-        if (u2f_data) {
-            if (hid_u2f_write_poll(u2f_data)) {
-                u2f_data = NULL;
-            }
+            received = true;
         }
 #endif
 
@@ -89,6 +93,7 @@ void firmware_main_loop(void)
 #if APP_U2F == 1
         usb_processing_process(usb_processing_u2f());
 #endif
+        _write_queued();
         /*
          * If USB has generated events at the application level,
          * process them now.
@@ -98,11 +103,23 @@ void firmware_main_loop(void)
         u2f_process();
 #endif
 
+        // Rendering waits while a request or reply is being transferred.
+        if (received) {
+            screen_process_defer_frame();
+        }
         screen_process();
         /* And finally, run the high-level event processing. */
 
         rust_workflow_spin();
 
         rust_async_usb_spin();
+
+        _write_queued();
+
+        // A received frame needs a new read to be started.
+        if (received) {
+            main_loop_event_wake();
+        }
+        main_loop_event_wait();
     }
 }
@@ -52,6 +52,9 @@ static uint8_t _unstretched_retained_bip39_seed_encryption_key[32] = {0};
 // Stores the encrypted BIP-39 seed after bip39-unlock.
 static uint8_t _retained_bip39_seed_encrypted[64 + 64] = {0};
 static size_t _retained_bip39_seed_encrypted_len = 0;
+// HMAC-SHA256 context keyed with the U2F seed, holding the inner and outer midstates of the key.
+// Created on first use by keystore_u2f_hmac(), zeroed when the bip39 seed is deleted or replaced.
+static void* _u2f_hmac_ctx = NULL;
 
 /**
  * We allow seeds of 16, 24 or 32 bytes.
@@ -343,6 +346,8 @@ USE_RESULT static keystore_error_t _retain_seed(const uint8_t* seed, size_t seed
 
 USE_RESULT static bool _retain_bip39_seed(const uint8_t* bip39_seed)
 {
+    // The U2F seed is derived from the bip39 seed.
+    rust_hmac_sha256_free(&_u2f_hmac_ctx);
     random_32_bytes(_unstretched_retained_bip39_seed_encryption_key);
     uint8_t retained_bip39_seed_encryption_key[32] = {0};
     UTIL_CLEANUP_32(retained_bip39_seed_encryption_key);
@@ -378,6 +383,7 @@ static void _delete_retained_seeds(void)
         sizeof(_unstretched_retained_seed_encryption_key));
     util_zero(_retained_bip39_seed_encrypted, sizeof(_retained_bip39_seed_encrypted));
     _retained_bip39_seed_encrypted_len = 0;
+    rust_hmac_sha256_free(&_u2f_hmac_ctx);
 }
 
 keystore_error_t keystore_unlock(
@@ -709,6 +715,26 @@ bool keystore_get_u2f_seed(uint8_t* seed_out)
     return true;
 }
 
+bool keystore_u2f_hmac(const uint8_t* msg, size_t msg_len, uint8_t* mac_out)
+{
+    if (keystore_is_locked()) {
+        return false;
+    }
+    if (_u2f_hmac_ctx == NULL) {
+        uint8_t seed[KEYSTORE_U2F_SEED_LENGTH] = {0};
+        UTIL_CLEANUP_32(seed);
+        if (!keystore_get_u2f_seed(seed)) {
+            return false;
+        }
+        _u2f_hmac_ctx = rust_hmac_sha256_new(rust_util_bytes(seed, sizeof(seed)));
+    }
+    rust_hmac_sha256_compute(
+        _u2f_hmac_ctx,
+        rust_util_bytes(msg, msg_len),
+        rust_util_bytes_mut(mac_out, HMAC_SHA256_LEN));
+    return true;
+}
+
 bool keystore_get_ed25519_seed(uint8_t* seed_out)
 {
     uint8_t bip39_seed[64] = {0};
@@ -980,4 +1006,58 @@ const uint8_t* keystore_test_get_retained_bip39_seed_encrypted(size_t* len_out)
     *len_out = _retained_bip39_seed_encrypted_len;
     return _retained_bip39_seed_encrypted;
 }
+
+void keystore_test_get_state(keystore_test_state_t* state_out)
+{
+    memset(state_out, 0, sizeof(*state_out));
+    state_out->is_unlocked_device = _is_unlocked_device;
+    memcpy(
+        state_out->unstretched_retained_seed_encryption_key,
+        _unstretched_retained_seed_encryption_key,
+        sizeof(_unstretched_retained_seed_encryption_key));
+    memcpy(
+        state_out->retained_seed_encrypted,
+        _retained_seed_encrypted,
+        sizeof(_retained_seed_encrypted));
+    state_out->retained_seed_encrypted_len = (uint32_t)_retained_seed_encrypted_len;
+    state_out->is_unlocked_bip39 = _is_unlocked_bip39;
+    memcpy(
+        state_out->unstretched_retained_bip39_seed_encryption_key,
+        _unstretched_retained_bip39_seed_encryption_key,
+        sizeof(_unstretched_retained_bip39_seed_encryption_key));
+    memcpy(
+        state_out->retained_bip39_seed_encrypted,
+        _retained_bip39_seed_encrypted,
+        sizeof(_retained_bip39_seed_encrypted));
+    state_out->retained_bip39_seed_encrypted_len = (uint32_t)_retained_bip39_seed_encrypted_len;
+}
+
+void keystore_test_set_state(const keystore_test_state_t* state)
+{
+    if (state->retained_seed_encrypted_len > sizeof(_retained_seed_encrypted) ||
+        state->retained_bip39_seed_encrypted_len > sizeof(_retained_bip39_seed_encrypted)) {
+        Abort("invalid keystore state");
+    }
+    keystore_lock();
+    memcpy(
+        _unstretched_retained_seed_encryption_key,
+        state->unstretched_retained_seed_encryption_key,
+        sizeof(_unstretched_retained_seed_encryption_key));
+    memcpy(
+        _retained_seed_encrypted,
+        state->retained_seed_encrypted,
+        sizeof(_retained_seed_encrypted));
+    _retained_seed_encrypted_len = state->retained_seed_encrypted_len;
+    memcpy(
+        _unstretched_retained_bip39_seed_encryption_key,
+        state->unstretched_retained_bip39_seed_encryption_key,
+        sizeof(_unstretched_retained_bip39_seed_encryption_key));
+    memcpy(
+        _retained_bip39_seed_encrypted,
+        state->retained_bip39_seed_encrypted,
+        sizeof(_retained_bip39_seed_encrypted));
+    _retained_bip39_seed_encrypted_len = state->retained_bip39_seed_encrypted_len;
+    _is_unlocked_device = state->is_unlocked_device;
+    _is_unlocked_bip39 = state->is_unlocked_bip39;
+}
 #endif
@@ -228,6 +228,18 @@ USE_RESULT bool keystore_secp256k1_sign(
  */
 USE_RESULT bool keystore_get_u2f_seed(uint8_t* seed_out);
 
+/**
+ * Computes HMAC-SHA256 keyed with the U2F seed (see keystore_get_u2f_seed()).
+ * The inner and outer HMAC midstates of the U2F seed are computed on the first call after unlock
+ * and retained until the keystore is locked, so later calls skip the seed derivation (and the
+ * securechip roundtrip it requires) and only hash the message.
+ * @param[in] msg message to authenticate.
+ * @param[in] msg_len length of msg.
+ * @param[out] mac_out must be HMAC_SHA256_LEN bytes.
+ * @return false if the keystore is locked or the U2F seed could not be derived.
+ */
+USE_RESULT bool keystore_u2f_hmac(const uint8_t* msg, size_t msg_len, uint8_t* mac_out);
+
 /**
  * Get the seed to be used for ed25519 applications such as Cardano. The output is the root key to
  * BIP32-ED25519.
@@ -326,6 +338,29 @@ void keystore_mock_unlocked(const uint8_t* seed, size_t seed_len, const uint8_t*
 
 const uint8_t* keystore_test_get_retained_seed_encrypted(size_t* len_out);
 const uint8_t* keystore_test_get_retained_bip39_seed_encrypted(size_t* len_out);
+
+/**
+ * The RAM state of the keystore, i.e. whether it is unlocked and the encrypted retained seeds.
+ * Used by the simulator to save and restore an unlocked device.
+ */
+typedef struct {
+    bool is_unlocked_device;
+    uint8_t unstretched_retained_seed_encryption_key[32];
+    uint8_t retained_seed_encrypted[KEYSTORE_MAX_SEED_LENGTH + 64];
+    uint32_t retained_seed_encrypted_len;
+    bool is_unlocked_bip39;
+    uint8_t unstretched_retained_bip39_seed_encryption_key[32];
+    uint8_t retained_bip39_seed_encrypted[64 + 64];
+    uint32_t retained_bip39_seed_encrypted_len;
+} keystore_test_state_t;
+
+void keystore_test_get_state(keystore_test_state_t* state_out);
+/**
+ * Restores a state obtained by `keystore_test_get_state()`. The retained seeds can only be
+ * decrypted if the securechip KDF behaves the same as when the state was saved, which is the case
+ * for the mocked securechip.
+ */
+void keystore_test_set_state(const keystore_test_state_t* state);
 #endif
 
 #endif
@@ -0,0 +1,65 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "main_loop_event.h"
+
+#ifndef TESTING
+#include <hal_atomic.h>
+#include <samd51j20a.h>
+#else
+#define CRITICAL_SECTION_ENTER()
+#define CRITICAL_SECTION_LEAVE()
+#endif
+
+// Pending main_loop_event_t bits, plus _WAKE if only a wake-up is pending.
+static volatile uint32_t _pending_events = 0;
+
+#define _WAKE (1U << 31)
+
+void main_loop_event_post(uint32_t events)
+{
+    CRITICAL_SECTION_ENTER();
+    _pending_events |= events;
+    CRITICAL_SECTION_LEAVE();
+}
+
+void main_loop_event_wake(void)
+{
+    main_loop_event_post(_WAKE);
+}
+
+uint32_t main_loop_event_take(void)
+{
+    uint32_t events;
+    CRITICAL_SECTION_ENTER();
+    events = _pending_events;
+    _pending_events = 0;
+    CRITICAL_SECTION_LEAVE();
+    return events & ~_WAKE;
+}
+
+void main_loop_event_wait(void)
+{
+#ifndef TESTING
+    // With interrupts masked, an interrupt becoming pending after the check still wakes up WFI. It
+    // is serviced as soon as interrupts are enabled again.
+    __disable_irq();
+    if (_pending_events == 0) {
+        __DSB();
+        __WFI();
+    }
+    __enable_irq();
+#endif
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef _MAIN_LOOP_EVENT_H_
+#define _MAIN_LOOP_EVENT_H_
+
+#include <stdint.h>
+
+/**
+ * Events posted (mostly from interrupt context) to wake up the main loop. They are bit flags;
+ * several events of the same kind posted before the main loop takes them collapse into one.
+ *
+ * Most work (USB frames and timeouts, touch measurements, due frames) is polled for by the main
+ * loop in every iteration anyway; interrupts producing such work only call
+ * `main_loop_event_wake()`. An event is only defined for work the main loop runs only when it was
+ * posted.
+ */
+typedef enum {
+    // The U2F timer ticked, timed out U2F transactions have to be answered.
+    MAIN_LOOP_EVENT_TIMER = 1U << 0,
+} main_loop_event_t;
+
+/**
+ * Posts the given events (bitwise OR of main_loop_event_t values). Safe to call from interrupts.
+ */
+void main_loop_event_post(uint32_t events);
+
+/**
+ * Makes the main loop run another iteration without posting an event, for work it polls for.
+ * Safe to call from interrupts.
+ */
+void main_loop_event_wake(void);
+
+/**
+ * Returns and clears all events posted since the last call.
+ */
+uint32_t main_loop_event_take(void);
+
+/**
+ * Puts the CPU to sleep until the next interrupt, unless an event or wake-up is already pending.
+ * An event or wake-up posted right before sleeping is never missed. Interrupts that do neither
+ * (e.g. the 1ms RTC tick of TIMER_0) also wake the CPU, so work that is not signalled is delayed
+ * by at most one tick.
+ *
+ * No-op in unit tests and the simulator.
+ */
+void main_loop_event_wait(void);
+
+#endif
@@ -213,8 +213,17 @@ static bool _write_to_address(uint32_t base, uint32_t offset, uint8_t* chunk)
 #endif
 }
 
+// RAM copy of the multisig/policy registrations stored in CHUNK_2, so lookups during signing and
+// address verification do not have to copy and scan the whole chunk every time. Loaded on first
+// use and dropped whenever CHUNK_2 is written or erased.
+static multisig_configuration_t _multisig_index[MEMORY_MULTISIG_NUM_ENTRIES];
+static bool _multisig_index_valid = false;
+
 static bool _write_chunk(uint32_t chunk_num, uint8_t* chunk)
 {
+    if (chunk_num == CHUNK_2) {
+        _multisig_index_valid = false;
+    }
 #ifdef TESTING
     return memory_write_chunk_mock(chunk_num, chunk);
 #else
@@ -234,6 +243,25 @@ static void _read_chunk(uint32_t chunk_num, uint8_t* chunk_out)
 #endif
 }
 
+static void _multisig_index_load(void)
+{
+    if (_multisig_index_valid) {
+        return;
+    }
+    chunk_2_t chunk = {0};
+    CLEANUP_CHUNK(chunk);
+    _read_chunk(CHUNK_2, chunk.bytes);
+    memcpy(_multisig_index, chunk.fields.multisig_configs, sizeof(_multisig_index));
+    _multisig_index_valid = true;
+}
+
+#ifdef TESTING
+void memory_multisig_index_invalidate(void)
+{
+    _multisig_index_valid = false;
+}
+#endif
+
 static const memory_interface_functions_t* _interface_functions = NULL;
 
 /********* Exposed functions ****************/
@@ -813,13 +841,11 @@ memory_result_t memory_multisig_set_by_hash(const uint8_t* hash, const char* nam
         return MEMORY_ERR_INVALID_INPUT;
     }
 
-    chunk_2_t chunk = {0};
-    CLEANUP_CHUNK(chunk);
-    _read_chunk(CHUNK_2, chunk.bytes);
+    _multisig_index_load();
 
     // Error if there is already a different multisig config with the same name.
     for (size_t i = 0; i < MEMORY_MULTISIG_NUM_ENTRIES; i++) {
-        const multisig_configuration_t* multisig = &chunk.fields.multisig_configs[i];
+        const multisig_configuration_t* multisig = &_multisig_index[i];
         if (STREQ(multisig->name, name)) {
             if (!MEMEQ(multisig->hash, hash, sizeof(multisig->hash))) {
                 return MEMORY_ERR_DUPLICATE_NAME;
@@ -829,6 +855,10 @@ memory_result_t memory_multisig_set_by_hash(const uint8_t* hash, const char* nam
         }
     }
 
+    chunk_2_t chunk = {0};
+    CLEANUP_CHUNK(chunk);
+    _read_chunk(CHUNK_2, chunk.bytes);
+
     // This will be true if the hash already exists.
     bool found = false;
     // This is the slot we will write to.
@@ -862,17 +892,18 @@ memory_result_t memory_multisig_set_by_hash(const uint8_t* hash, const char* nam
     if (!_write_chunk(CHUNK_2, chunk.bytes)) {
         return MEMORY_ERR_UNKNOWN;
     }
+    // Keep the index in sync with what was just written instead of reloading it from flash.
+    memcpy(_multisig_index, chunk.fields.multisig_configs, sizeof(_multisig_index));
+    _multisig_index_valid = true;
     return MEMORY_OK;
 }
 
 bool memory_multisig_get_by_hash(const uint8_t* hash, char* name_out)
 {
-    chunk_2_t chunk = {0};
-    CLEANUP_CHUNK(chunk);
-    _read_chunk(CHUNK_2, chunk.bytes);
+    _multisig_index_load();
 
     for (size_t i = 0; i < MEMORY_MULTISIG_NUM_ENTRIES; i++) {
-        const multisig_configuration_t* multisig = &chunk.fields.multisig_configs[i];
+        const multisig_configuration_t* multisig = &_multisig_index[i];
         if (MEMEQ(multisig->hash, hash, sizeof(multisig->hash))) {
             if (name_out != NULL) {
                 snprintf(name_out, sizeof(multisig->name), "%s", multisig->name);
@@ -106,4 +106,14 @@ void smarteeprom_disable(void);
  */
 void smarteeprom_bb02_config(void);
 
+#ifdef TESTING
+/**
+ * Raw contents of the mocked SmartEEPROM, e.g. to save and restore the simulated device state.
+ *
+ * @param[out] len_out Size of the image in bytes.
+ * @return the image, or NULL if the SmartEEPROM is not set up.
+ */
+uint8_t* smarteeprom_mock_image(size_t* len_out);
+#endif
+
 #endif // __SMARTEEPROM_H
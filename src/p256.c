@@ -0,0 +1,40 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "p256.h"
+
+#include <rust/rust.h>
+
+void p256_pubkey(const uint8_t* private_key, uint8_t* public_key_out)
+{
+    rust_p256_pubkey(
+        rust_util_bytes(private_key, P256_PRIVKEY_LEN),
+        rust_util_bytes_mut(public_key_out, P256_PUBKEY_LEN));
+}
+
+void p256_sign(const uint8_t* private_key, const uint8_t* hash, uint8_t* sig_out)
+{
+    rust_p256_sign(
+        rust_util_bytes(private_key, P256_PRIVKEY_LEN),
+        rust_util_bytes(hash, 32),
+        rust_util_bytes_mut(sig_out, P256_SIG_LEN));
+}
+
+bool p256_verify(const uint8_t* public_key, const uint8_t* hash, const uint8_t* sig)
+{
+    return rust_p256_verify(
+        rust_util_bytes(public_key, P256_PUBKEY_LEN),
+        rust_util_bytes(hash, 32),
+        rust_util_bytes(sig, P256_SIG_LEN));
+}
@@ -0,0 +1,55 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _P256_H_
+#define _P256_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * ECDSA over NIST P-256, as used by U2F, implemented in software (Rust `p256` crate). It is
+ * constant-time with respect to the private key and the nonce, with the nonce derived
+ * deterministically (RFC6979).
+ */
+
+#define P256_PRIVKEY_LEN 32
+#define P256_PUBKEY_LEN 64
+#define P256_SIG_LEN 64
+
+/**
+ * Derives the public key of a private key.
+ * @param[in] private_key P256_PRIVKEY_LEN bytes.
+ * @param[out] public_key_out P256_PUBKEY_LEN bytes, the X and Y coordinates.
+ */
+void p256_pubkey(const uint8_t* private_key, uint8_t* public_key_out);
+
+/**
+ * Signs a 32 byte digest.
+ * @param[in] private_key P256_PRIVKEY_LEN bytes.
+ * @param[in] hash 32 bytes, signed directly without further hashing.
+ * @param[out] sig_out P256_SIG_LEN bytes, R and S.
+ */
+void p256_sign(const uint8_t* private_key, const uint8_t* hash, uint8_t* sig_out);
+
+/**
+ * Verifies a signature of a 32 byte digest.
+ * @param[in] public_key P256_PUBKEY_LEN bytes, the X and Y coordinates.
+ * @param[in] hash 32 bytes which were signed directly without further hashing.
+ * @param[in] sig P256_SIG_LEN bytes, R and S.
+ * @return true if the signature is valid.
+ */
+bool p256_verify(const uint8_t* public_key, const uint8_t* hash, const uint8_t* sig);
+
+#endif
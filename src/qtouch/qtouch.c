@@ -30,6 +30,7 @@ Copyright (c) 2017 Microchip. All rights reserved.
 #include "touch_api_ptc.h"
 #include "util.h"
 #include <driver_init.h>
+#include <main_loop_event.h>
 #include <platform_config.h>
 
 /*----------------------------------------------------------------------------
@@ -321,6 +322,7 @@ Notes  :
 static void qtm_measure_complete_callback(void)
 {
     qtm_control.binding_layer_flags |= (1 << node_pp_request);
+    main_loop_event_wake();
 }
 
 /*============================================================================
@@ -504,6 +506,7 @@ void qtouch_timer_handler(void)
     /* Count complete - Measure touch sensors */
     qtm_control.binding_layer_flags |= (1U << time_to_measure_touch);
     qtm_update_qtlib_timer(DEF_TOUCH_MEASUREMENT_PERIOD_MS);
+    main_loop_event_wake();
 }
 
 static void qtouch_timer_task_cb(const struct timer_task* const timer_task)
@@ -542,56 +545,73 @@ uint8_t qtouch_get_sensor_state(uint16_t sensor_node)
     return (qtlib_key_set1.qtm_touch_key_data[sensor_node].sensor_state);
 }
 
-/* Holds preceding unfiltered scroller positions */
-static uint16_t sensor_previous_filtered_reading[DEF_NUM_SENSORS][DEF_SENSOR_NUM_PREV_POS] = {0};
+/*
+ * Ring buffers of the preceding (saturated, unaveraged) sensor readings, one per sensor, with
+ * their running sums. All sensors are filtered together once per scan, so they share the write
+ * index.
+ */
+static uint16_t sensor_previous_reading[DEF_NUM_SENSORS][DEF_SENSOR_NUM_PREV_POS] = {0};
+static uint16_t sensor_previous_reading_sum[DEF_NUM_SENSORS] = {0};
+static uint8_t sensor_previous_reading_index = 0;
 
-/* Custom sensor signal filter. */
-uint16_t qtouch_get_sensor_node_signal_filtered(uint16_t sensor_node)
+/* Output of the custom sensor signal filter of the most recent scan. */
+static uint16_t sensor_filtered_reading[DEF_NUM_SENSORS] = {0};
+
+static bool qtouch_is_edge_sensor(uint16_t sensor_node)
 {
-    // Filter the sensor signal.
+    return (sensor_node == DEF_SCROLLER_OFFSET_0) || (sensor_node == DEF_SCROLLER_OFFSET_1) ||
+           (sensor_node == DEF_SCROLLER_OFFSET_0 + DEF_SCROLLER_NUM_CHANNELS - 1) ||
+           (sensor_node == DEF_SCROLLER_OFFSET_1 + DEF_SCROLLER_NUM_CHANNELS - 1);
+}
+
+/* Custom sensor signal filter, run for all sensors once per scan. */
+static void qtouch_filter_sensor_signals(void)
+{
+    // Filter the sensor signals.
     //
-    // Smooth it out and saturate it so that values never go beyond DEF_SENSOR_CEILING.
+    // Smooth them out and saturate them so that values never go beyond DEF_SENSOR_CEILING.
     // This helps to mitigate 'jumpy' channels that exist at higher sensor readings when
     // in noisy environments.
     //
-    uint16_t X;
-    uint16_t sensor_raw = qtouch_get_sensor_node_signal(sensor_node);
-    uint16_t sensor_reference = qtouch_get_sensor_node_reference(sensor_node);
-
-    if (sensor_reference == 0) {
-        // If a sensor reference is 0, it means that the sensor is not yet calibrated (or dead).
-        // The signal can be high anyway, which makes it look like the sensor is being touched when
-        // it isn't.
-        return 0;
-    }
-    X = sensor_raw < sensor_reference ? 0 : sensor_raw - sensor_reference;
-    // Add more weight to edge buttons because they are physically smaller (smaller readings).
-    if ((sensor_node == DEF_SCROLLER_OFFSET_0) || (sensor_node == DEF_SCROLLER_OFFSET_1) ||
-        (sensor_node == DEF_SCROLLER_OFFSET_0 + DEF_SCROLLER_NUM_CHANNELS - 1) ||
-        (sensor_node == DEF_SCROLLER_OFFSET_1 + DEF_SCROLLER_NUM_CHANNELS - 1)) {
-        X = (uint16_t)((double)X * (1 + DEF_SENSOR_EDGE_WEIGHT));
-    }
-    // Saturate out-of-range readings.
-    X = (X > DEF_SENSOR_CEILING) ? DEF_SENSOR_CEILING : X;
-
-    // Calculate sensor readout using a moving average
-    // The moving average wieghts previous N readings twice current reading
-    uint16_t moving_average_cummulative_weight = 1; // Add one for current reading calculated above
-    uint16_t X_ave = X;
-    for (size_t j = 0; j < DEF_SENSOR_NUM_PREV_POS; j++) {
-        moving_average_cummulative_weight += 2;
-        X_ave += sensor_previous_filtered_reading[sensor_node][j] * 2;
-    }
-    X_ave = X_ave / moving_average_cummulative_weight;
-
-    // Update recorded previous positions
-    for (size_t j = 0; j < DEF_SENSOR_NUM_PREV_POS - 1; j++) {
-        sensor_previous_filtered_reading[sensor_node][j] =
-            sensor_previous_filtered_reading[sensor_node][j + 1];
+    // Integer arithmetic only: the Cortex-M4F has no double precision FPU.
+    const uint8_t index = sensor_previous_reading_index;
+    for (uint16_t sensor_node = 0; sensor_node < DEF_NUM_SENSORS; sensor_node++) {
+        uint16_t sensor_raw = qtouch_get_sensor_node_signal(sensor_node);
+        uint16_t sensor_reference = qtouch_get_sensor_node_reference(sensor_node);
+
+        if (sensor_reference == 0) {
+            // If a sensor reference is 0, it means that the sensor is not yet calibrated (or
+            // dead). The signal can be high anyway, which makes it look like the sensor is being
+            // touched when it isn't. Its history is left as is; the moving average does not
+            // depend on the order of the previous readings.
+            sensor_filtered_reading[sensor_node] = 0;
+            continue;
+        }
+        uint32_t X = sensor_raw < sensor_reference ? 0 : sensor_raw - sensor_reference;
+        // Add more weight to edge buttons because they are physically smaller (smaller readings).
+        if (qtouch_is_edge_sensor(sensor_node)) {
+            X = X * (100 + DEF_SENSOR_EDGE_WEIGHT_PERCENT) / 100;
+        }
+        // Saturate out-of-range readings.
+        X = (X > DEF_SENSOR_CEILING) ? DEF_SENSOR_CEILING : X;
+
+        // Calculate sensor readout using a moving average
+        // The moving average weights previous N readings twice current reading
+        uint16_t* previous = sensor_previous_reading[sensor_node];
+        uint16_t* previous_sum = &sensor_previous_reading_sum[sensor_node];
+        sensor_filtered_reading[sensor_node] =
+            (uint16_t)((X + 2 * (uint32_t)*previous_sum) / (1 + 2 * DEF_SENSOR_NUM_PREV_POS));
+
+        // Replace the oldest recorded reading
+        *previous_sum = *previous_sum - previous[index] + (uint16_t)X;
+        previous[index] = (uint16_t)X;
     }
-    sensor_previous_filtered_reading[sensor_node][DEF_SENSOR_NUM_PREV_POS - 1] = X;
+    sensor_previous_reading_index = (index + 1) % DEF_SENSOR_NUM_PREV_POS;
+}
 
-    return X_ave;
+uint16_t qtouch_get_sensor_node_signal_filtered(uint16_t sensor_node)
+{
+    return sensor_filtered_reading[sensor_node];
 }
 
 bool qtouch_is_scroller_active(uint16_t scroller)
@@ -606,6 +626,7 @@ uint16_t qtouch_get_scroller_position(uint16_t sensor_node)
 
 void qtouch_process_scroller_positions(void)
 {
+    qtouch_filter_sensor_signals();
     for (uint8_t scroller = 0; scroller < DEF_NUM_SCROLLERS; scroller++) {
         uint8_t i, j;
         uint16_t sum = 0;
@@ -620,8 +641,8 @@ void qtouch_process_scroller_positions(void)
             DEF_SCROLLER_RESOLUTION};
 
         for (i = 0; i < DEF_SCROLLER_NUM_CHANNELS; i++) {
-            filtered_readings[i] = qtouch_get_sensor_node_signal_filtered(
-                i + (scroller ? DEF_SCROLLER_OFFSET_1 : DEF_SCROLLER_OFFSET_0));
+            filtered_readings[i] = sensor_filtered_reading
+                [i + (scroller ? DEF_SCROLLER_OFFSET_1 : DEF_SCROLLER_OFFSET_0)];
             min_sensor_reading = (filtered_readings[i] < min_sensor_reading) ? filtered_readings[i]
                                                                              : min_sensor_reading;
             max_sensor_reading = (filtered_readings[i] > max_sensor_reading) ? filtered_readings[i]
@@ -250,8 +250,8 @@ extern "C" {
     4 // Number of previous scroller positions to remember; used in a simple filter
 #define DEF_SCROLLER_OFF \
     0xFFFF // Marker for indicating scroller reading does not exceed detection threshold
-#define DEF_SENSOR_EDGE_WEIGHT \
-    0.15 // Percent added weight to edge sensors, which are physically smaller
+#define DEF_SENSOR_EDGE_WEIGHT_PERCENT \
+    15 // Percent added weight to edge sensors, which are physically smaller
 #define DEF_SENSOR_NUM_PREV_POS \
     4 // Number of previous sensor positions to remember; used in a simple filter
 #define DEF_SENSOR_CEILING \
@@ -30,8 +30,12 @@
 #include "usb/usb_frame.h"
 
 // TODO: specify generic size
-// The queue has enough room for a single maximum size packet
-#define QUEUE_NUM_REPORTS (USB_DATA_MAX_LEN / USB_REPORT_SIZE)
+// By default, the queue has enough room for all frames of a single maximum size message, so that a
+// whole reply can be queued and sent in one burst. One slot is always kept free to tell a full
+// queue from an empty one.
+#ifndef QUEUE_NUM_REPORTS
+#define QUEUE_NUM_REPORTS (USB_DATA_MAX_FRAMES + 1)
+#endif
 #define QUEUE_SIZE (QUEUE_NUM_REPORTS * USB_REPORT_SIZE)
 
 // `start` and `end` are indices into `items`
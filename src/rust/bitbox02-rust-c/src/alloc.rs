@@ -12,6 +12,23 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+use util::arena::ARENA;
+
+/// Size of the arena serving the allocations made while processing an API request, see
+/// `util::arena`. It is taken from the heap the first time it is needed.
+///
+/// Peak arena usage measured on a 64-bit host, with the generated protobuf types and the
+/// `miniscript` crate used the same way as in the firmware:
+/// - decoding a 16 key policy registration and parsing the policy: 15216 bytes (wsh), 12829 bytes
+///   (tr).
+/// - building and encoding a full BTC pub range response (66 xpubs): 16374 bytes.
+/// - decoding a full size Cardano transaction (66 outputs, 7565 bytes): 35543 bytes.
+///
+/// Pointers and lengths are half as large on the device, so all but the Cardano transaction fit.
+/// Large Cardano transactions can be streamed instead; otherwise, what does not fit is allocated
+/// on the heap, as for any request that fills the arena.
+const ARENA_SIZE: usize = 16 * 1024;
+
 struct BB02Allocator;
 
 extern "C" {
@@ -21,10 +38,39 @@ extern "C" {
 
 unsafe impl core::alloc::GlobalAlloc for BB02Allocator {
     unsafe fn alloc(&self, layout: core::alloc::Layout) -> *mut u8 {
-        malloc(layout.size()) as _
+        if ARENA.is_active() && !ARENA.has_buffer() {
+            ARENA.init(malloc(ARENA_SIZE) as _, ARENA_SIZE);
+        }
+        match ARENA.alloc(layout) {
+            Some(ptr) => ptr,
+            None => malloc(layout.size()) as _,
+        }
     }
-    unsafe fn dealloc(&self, ptr: *mut u8, _layout: core::alloc::Layout) {
-        free(ptr as _)
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: core::alloc::Layout) {
+        if ARENA.contains(ptr) {
+            ARENA.dealloc(ptr, layout);
+        } else {
+            free(ptr as _)
+        }
+    }
+    unsafe fn realloc(
+        &self,
+        ptr: *mut u8,
+        layout: core::alloc::Layout,
+        new_size: usize,
+    ) -> *mut u8 {
+        // Vecs and Strings growing one push at a time are the common case; the most recent arena
+        // allocation can simply be extended.
+        if ARENA.contains(ptr) && ARENA.realloc_in_place(ptr, layout, new_size) {
+            return ptr;
+        }
+        let new_layout = core::alloc::Layout::from_size_align_unchecked(new_size, layout.align());
+        let new_ptr = self.alloc(new_layout);
+        if !new_ptr.is_null() {
+            core::ptr::copy_nonoverlapping(ptr, new_ptr, core::cmp::min(layout.size(), new_size));
+            self.dealloc(ptr, layout);
+        }
+        new_ptr
     }
 }
 
@@ -54,6 +54,14 @@ fn panic(info: &core::panic::PanicInfo) -> ! {
     loop {}
 }
 
+/// Creates the secp256k1 context shared by all Rust code. Called once at startup, so that the
+/// context is not created in the middle of a request.
+#[cfg(feature = "firmware")]
+#[no_mangle]
+pub extern "C" fn rust_secp256k1_init() {
+    bitbox02::secp256k1::context();
+}
+
 #[no_mangle]
 pub extern "C" fn rust_rtt_init() {
     ::util::log::rtt_init();
@@ -31,18 +31,60 @@ pub extern "C" fn rust_p256_pubkey(
 /// private_key must be 32 bytes.
 /// msg must be 32 bytes digest and is signed directly without further hashing.
 /// sig_out must be 64 bytes.
+///
+/// The nonce is derived deterministically (RFC6979) and all arithmetic involving the private key
+/// and the nonce is constant-time. Unlike `p256::ecdsa::SigningKey`, this does not derive the
+/// public key, saving one scalar multiplication per signature.
 #[no_mangle]
 pub extern "C" fn rust_p256_sign(
     private_key: crate::util::Bytes,
     msg: crate::util::Bytes,
     mut sig_out: crate::util::BytesMut,
 ) {
-    use p256::ecdsa::{signature::hazmat::PrehashSigner, Signature, SigningKey};
-    let signing_key = SigningKey::from_slice(private_key.as_ref()).unwrap();
-    let (signature, _): (Signature, _) = signing_key.sign_prehash(msg.as_ref()).unwrap();
+    use ecdsa::hazmat::{bits2field, SignPrimitive};
+    let secret_key = p256::SecretKey::from_slice(private_key.as_ref()).unwrap();
+    let z = bits2field::<p256::NistP256>(msg.as_ref()).unwrap();
+    let (signature, _) = secret_key
+        .to_nonzero_scalar()
+        .try_sign_prehashed_rfc6979::<sha2::Sha256>(&z, &[])
+        .unwrap();
     sig_out.as_mut().copy_from_slice(&signature.to_bytes());
 }
 
+/// Verifies a ECC-DSA NIST-P256 signature.
+/// public_key must be 64 bytes (uncompressed X and Y coordinates without the 0x04 prefix).
+/// msg must be 32 bytes digest which was signed directly without further hashing.
+/// sig must be 64 bytes.
+/// Returns true if the signature is valid.
+#[no_mangle]
+pub extern "C" fn rust_p256_verify(
+    public_key: crate::util::Bytes,
+    msg: crate::util::Bytes,
+    sig: crate::util::Bytes,
+) -> bool {
+    use p256::ecdsa::{signature::hazmat::PrehashVerifier, Signature, VerifyingKey};
+    let public_key = public_key.as_ref();
+    if public_key.len() != 64 {
+        return false;
+    }
+    let encoded_point = p256::EncodedPoint::from_affine_coordinates(
+        public_key[..32].into(),
+        public_key[32..].into(),
+        false,
+    );
+    let verifying_key = match VerifyingKey::from_encoded_point(&encoded_point) {
+        Ok(key) => key,
+        Err(_) => return false,
+    };
+    let signature = match Signature::from_slice(sig.as_ref()) {
+        Ok(sig) => sig,
+        Err(_) => return false,
+    };
+    verifying_key
+        .verify_prehash(msg.as_ref(), &signature)
+        .is_ok()
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -84,4 +126,46 @@ mod tests {
             "5a1f4c00a5104edd39fc8f55863b04a82c662c56448a10c3a35fd4d0decb9d8a8240cbcdd251c6d76d78981b14092c01466c90ad7e1c699f2c5e11523ec6df8c",
         );
     }
+
+    #[test]
+    fn test_rust_p256_verify() {
+        let privkey = b"\x50\x3e\x32\xee\xb9\xca\xb8\x67\x3f\x78\x47\xc0\x47\xfa\x57\xad\x2b\xe0\x48\x5d\x07\x59\x94\x84\x13\xcc\x8c\x00\x2b\x52\x9f\xe4";
+        let mut pubkey = [0u8; 64];
+        rust_p256_pubkey(
+            unsafe { crate::util::rust_util_bytes(privkey.as_ptr(), privkey.len()) },
+            unsafe { crate::util::rust_util_bytes_mut(pubkey.as_mut_ptr(), pubkey.len()) },
+        );
+        let msg = Sha256::digest(b"msg");
+        let mut sig = [0u8; 64];
+        rust_p256_sign(
+            unsafe { crate::util::rust_util_bytes(privkey.as_ptr(), privkey.len()) },
+            unsafe { crate::util::rust_util_bytes(msg.as_ptr(), msg.len()) },
+            unsafe { crate::util::rust_util_bytes_mut(sig.as_mut_ptr(), sig.len()) },
+        );
+        let verify = |pubkey: &[u8], msg: &[u8], sig: &[u8]| {
+            rust_p256_verify(
+                unsafe { crate::util::rust_util_bytes(pubkey.as_ptr(), pubkey.len()) },
+                unsafe { crate::util::rust_util_bytes(msg.as_ptr(), msg.len()) },
+                unsafe { crate::util::rust_util_bytes(sig.as_ptr(), sig.len()) },
+            )
+        };
+        assert!(verify(&pubkey, &msg, &sig));
+
+        // Wrong message.
+        let other_msg = Sha256::digest(b"other msg");
+        assert!(!verify(&pubkey, &other_msg, &sig));
+
+        // Tampered signature.
+        let mut bad_sig = sig;
+        bad_sig[63] ^= 1;
+        assert!(!verify(&pubkey, &msg, &bad_sig));
+
+        // Not a point on the curve.
+        let mut bad_pubkey = pubkey;
+        bad_pubkey[63] ^= 1;
+        assert!(!verify(&bad_pubkey, &msg, &sig));
+
+        // Wrong public key length.
+        assert!(!verify(&pubkey[..63], &msg, &sig));
+    }
 }
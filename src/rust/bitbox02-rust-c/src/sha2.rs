@@ -15,6 +15,7 @@
 extern crate alloc;
 
 use alloc::boxed::Box;
+use hmac::{Hmac, Mac};
 use sha2::Digest;
 use sha2::Sha256;
 use util::c_types::{c_uchar, c_void};
@@ -59,6 +60,52 @@ pub unsafe extern "C" fn rust_sha256(data: *const c_void, len: usize, out: *mut
     out.copy_from_slice(&hash[..]);
 }
 
+/// Keys a HMAC-SHA256 context. The context holds the inner and outer midstates of the key, so
+/// that every `rust_hmac_sha256_compute()` only hashes the message.
+/// Result must be freed by calling `rust_hmac_sha256_free()`.
+#[no_mangle]
+pub extern "C" fn rust_hmac_sha256_new(key: crate::util::Bytes) -> *mut c_void {
+    let mac = Hmac::<Sha256>::new_from_slice(key.as_ref()).unwrap();
+    Box::into_raw(Box::new(mac)) as *mut _
+}
+
+/// Computes HMAC-SHA256 of `msg` using the key the context was created with. The context is not
+/// modified and can be reused.
+/// Safety: ctx must be a valid context produced by `rust_hmac_sha256_new()`.
+/// `mac_out` must be 32 bytes long.
+#[no_mangle]
+pub unsafe extern "C" fn rust_hmac_sha256_compute(
+    ctx: *const c_void,
+    msg: crate::util::Bytes,
+    mut mac_out: crate::util::BytesMut,
+) {
+    #[allow(clippy::cast_ptr_alignment)] // ctx is properly aligned, see `Box::into_raw`.
+    let mut mac = (*(ctx as *const Hmac<Sha256>)).clone();
+    mac.update(msg.as_ref());
+    mac_out
+        .as_mut()
+        .copy_from_slice(&mac.finalize().into_bytes()[..]);
+}
+
+/// Zeroes and frees the context. Does nothing if `*ctx` is NULL.
+/// Safety: ctx must be a pointer to NULL or to a valid context produced by
+/// `rust_hmac_sha256_new()`. After this, `*ctx` is set to NULL.
+#[no_mangle]
+pub unsafe extern "C" fn rust_hmac_sha256_free(ctx: *mut *mut c_void) {
+    if (*ctx).is_null() {
+        return;
+    }
+    #[allow(clippy::cast_ptr_alignment)] // ctx is properly aligned, see `Box::into_raw`.
+    let mac = *ctx as *mut Hmac<Sha256>;
+    // The midstates are derived from the key and are as sensitive as the key itself.
+    util::zero(core::slice::from_raw_parts_mut(
+        mac as *mut u8,
+        core::mem::size_of::<Hmac<Sha256>>(),
+    ));
+    drop(Box::from_raw(mac));
+    *ctx = core::ptr::null_mut();
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -114,4 +161,29 @@ mod tests {
             &Sha256::digest(b"12345678901234567890123456789012")[..],
         );
     }
+
+    #[test]
+    fn test_hmac_sha256() {
+        let key = b"key";
+        let mut ctx =
+            rust_hmac_sha256_new(unsafe { crate::util::rust_util_bytes(key.as_ptr(), key.len()) });
+        // The context can be reused for multiple messages.
+        for msg in [&b"msg1"[..], &b"msg2"[..], &b""[..]] {
+            let mut result = [0u8; 32];
+            unsafe {
+                rust_hmac_sha256_compute(
+                    ctx,
+                    crate::util::rust_util_bytes(msg.as_ptr(), msg.len()),
+                    crate::util::rust_util_bytes_mut(result.as_mut_ptr(), result.len()),
+                );
+            }
+            let mut expected = Hmac::<Sha256>::new_from_slice(key).unwrap();
+            expected.update(msg);
+            assert_eq!(result, &expected.finalize().into_bytes()[..]);
+        }
+        unsafe { rust_hmac_sha256_free(&mut ctx) };
+        assert!(ctx.is_null());
+        // Freeing again is a no-op.
+        unsafe { rust_hmac_sha256_free(&mut ctx) };
+    }
 }
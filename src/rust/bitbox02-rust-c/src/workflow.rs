@@ -24,7 +24,7 @@ extern crate alloc;
 
 use alloc::boxed::Box;
 use alloc::string::String;
-use bitbox02_rust::bb02_async::{spin, Task};
+use bitbox02_rust::bb02_async::{Task, TaskSlot};
 use bitbox02_rust::workflow::confirm;
 use core::task::Poll;
 
@@ -35,11 +35,13 @@ enum TaskState<'a, O> {
 }
 
 static mut UNLOCK_STATE: TaskState<'static, Result<(), ()>> = TaskState::Nothing;
+static UNLOCK_SLOT: TaskSlot = TaskSlot::new();
 
 static mut CONFIRM_TITLE: Option<String> = None;
 static mut CONFIRM_BODY: Option<String> = None;
 static mut CONFIRM_PARAMS: Option<confirm::Params> = None;
 static mut CONFIRM_STATE: TaskState<'static, Result<(), confirm::UserAbort>> = TaskState::Nothing;
+static CONFIRM_SLOT: TaskSlot = TaskSlot::new();
 static mut BITBOX02_HAL: bitbox02_rust::hal::BitBox02Hal = bitbox02_rust::hal::BitBox02Hal::new();
 
 #[no_mangle]
@@ -47,6 +49,7 @@ pub unsafe extern "C" fn rust_workflow_spawn_unlock() {
     UNLOCK_STATE = TaskState::Running(Box::pin(bitbox02_rust::workflow::unlock::unlock(
         &mut BITBOX02_HAL,
     )));
+    UNLOCK_SLOT.wake();
 }
 
 #[no_mangle]
@@ -64,13 +67,15 @@ pub unsafe extern "C" fn rust_workflow_spawn_confirm(
 
     CONFIRM_STATE =
         TaskState::Running(Box::pin(confirm::confirm(CONFIRM_PARAMS.as_ref().unwrap())));
+    CONFIRM_SLOT.wake();
 }
 
+/// Polls the running workflows which were woken since they were last polled.
 #[no_mangle]
 pub unsafe extern "C" fn rust_workflow_spin() {
     match UNLOCK_STATE {
         TaskState::Running(ref mut task) => {
-            let result = spin(task);
+            let result = UNLOCK_SLOT.spin(task);
             if let Poll::Ready(result) = result {
                 UNLOCK_STATE = TaskState::ResultAvailable(result);
             }
@@ -79,7 +84,7 @@ pub unsafe extern "C" fn rust_workflow_spin() {
     }
     match CONFIRM_STATE {
         TaskState::Running(ref mut task) => {
-            let result = spin(task);
+            let result = CONFIRM_SLOT.spin(task);
             if let Poll::Ready(result) = result {
                 CONFIRM_STATE = TaskState::ResultAvailable(result);
             }
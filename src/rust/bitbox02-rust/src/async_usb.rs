@@ -15,7 +15,7 @@
 //! This module provides the executor for tasks that are spawned with an API request and deliver a
 //! USB response. Terminology: host = computer, device = BitBox02.
 
-use crate::bb02_async::{option, spin as spin_task, Task};
+use crate::bb02_async::{option, resolve, Task, TaskSlot};
 use alloc::boxed::Box;
 use alloc::vec::Vec;
 use core::cell::RefCell;
@@ -86,6 +86,9 @@ unsafe impl Sync for SafeUsbTaskState {}
 /// task).
 static USB_TASK_STATE: SafeUsbTaskState = SafeUsbTaskState(RefCell::new(UsbTaskState::Nothing));
 
+/// Tracks whether the usb api processing task needs to be polled.
+static USB_TASK_SLOT: TaskSlot = TaskSlot::new();
+
 /// Spawn a task to be spinned by the executor. This moves the state
 /// from Nothing to Running.
 ///
@@ -100,6 +103,7 @@ where
             let task: Task<UsbOut> = Box::pin(workflow(usb_in.to_vec()));
 
             *state = UsbTaskState::Running(Some(task), WaitingForNextRequestState::Idle);
+            USB_TASK_SLOT.wake();
         }
         _ => panic!("spawn: wrong state"),
     }
@@ -124,7 +128,7 @@ pub fn on_next_request(usb_in: &[u8]) {
             ref mut next_request_state @ WaitingForNextRequestState::AwaitingRequest,
         ) => {
             // Resolve NEXT_REQUEST future.
-            *NEXT_REQUEST.0.borrow_mut() = Some(usb_in.to_vec());
+            resolve(&NEXT_REQUEST.0, usb_in.to_vec());
 
             *next_request_state = WaitingForNextRequestState::Idle;
         }
@@ -132,8 +136,8 @@ pub fn on_next_request(usb_in: &[u8]) {
     }
 }
 
-/// Spin the currently running task, if there is one. Otherwise do
-/// nothing. This is supposed to be called from the mainloop.
+/// Spin the currently running task, if there is one and it was woken since it was last polled.
+/// Otherwise do nothing. This is supposed to be called from the mainloop.
 ///
 /// If this spin finishes the task, the state is moved to
 /// `ResultAvailable`, which contains the result.
@@ -149,7 +153,7 @@ pub fn spin() {
         _ => None,
     };
     if let Some(ref mut task) = popped_task {
-        match spin_task(task) {
+        match USB_TASK_SLOT.spin(task) {
             Poll::Ready(result) => {
                 *USB_TASK_STATE.0.borrow_mut() = UsbTaskState::ResultAvailable(result);
             }
@@ -13,9 +13,11 @@
 // limitations under the License.
 
 use alloc::boxed::Box;
+use alloc::vec::Vec;
 use core::cell::RefCell;
 use core::pin::Pin;
-use core::task::{Context, Poll};
+use core::sync::atomic::{AtomicBool, Ordering};
+use core::task::{Context, Poll, RawWaker, RawWakerVTable, Waker};
 
 /// Task is the top-level future which can be polled by an executor.
 /// Note that other futures awaited inside do not have to be pinned.
@@ -23,22 +25,100 @@ use core::task::{Context, Poll};
 /// 'static, or a future with non-'static input param references.
 pub type Task<'a, O> = Pin<Box<dyn core::future::Future<Output = O> + 'a>>;
 
-/// A primitive poll invocation for a task, with no waking functionality.
-pub fn spin<O>(task: &mut Task<O>) -> Poll<O> {
-    // TODO: statically allocate the context.
-    let waker = crate::waker_fn::waker_fn(|| {});
-    let context = &mut Context::from_waker(&waker);
-    task.as_mut().poll(context)
+/// An executor slot, holding at most one task at a time. The task is only polled by `spin()` after
+/// it was woken, i.e. after it was spawned or after an `option()` it is waiting on was resolved, so
+/// idle workflows do not cost anything in the main loop.
+pub struct TaskSlot {
+    woken: AtomicBool,
 }
 
+static TASK_SLOT_WAKER_VTABLE: RawWakerVTable = RawWakerVTable::new(
+    task_slot_waker_clone,
+    task_slot_waker_wake,
+    task_slot_waker_wake,
+    task_slot_waker_drop,
+);
+
+// The waker data is a `&'static TaskSlot`, so cloning and dropping are no-ops.
+unsafe fn task_slot_waker_clone(ptr: *const ()) -> RawWaker {
+    RawWaker::new(ptr, &TASK_SLOT_WAKER_VTABLE)
+}
+
+unsafe fn task_slot_waker_wake(ptr: *const ()) {
+    (*(ptr as *const TaskSlot)).wake();
+}
+
+unsafe fn task_slot_waker_drop(_ptr: *const ()) {}
+
+impl Default for TaskSlot {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl TaskSlot {
+    pub const fn new() -> Self {
+        TaskSlot {
+            woken: AtomicBool::new(false),
+        }
+    }
+
+    /// Marks the task in this slot as able to make progress. Must be called when a new task is
+    /// put into the slot, so it is polled for the first time.
+    pub fn wake(&self) {
+        self.woken.store(true, Ordering::Relaxed);
+    }
+
+    fn waker(&'static self) -> Waker {
+        let raw = RawWaker::new(self as *const Self as *const (), &TASK_SLOT_WAKER_VTABLE);
+        // Safety: the vtable functions uphold the RawWaker contract for a `&'static TaskSlot`.
+        unsafe { Waker::from_raw(raw) }
+    }
+
+    /// Polls the task, regardless of whether it was woken.
+    fn poll<O>(&'static self, task: &mut Task<O>) -> Poll<O> {
+        self.woken.store(false, Ordering::Relaxed);
+        let waker = self.waker();
+        let context = &mut Context::from_waker(&waker);
+        task.as_mut().poll(context)
+    }
+
+    /// Polls the task if it was woken since the last poll. Otherwise, returns `Poll::Pending`
+    /// without polling.
+    pub fn spin<O>(&'static self, task: &mut Task<O>) -> Poll<O> {
+        if !self.woken.load(Ordering::Relaxed) {
+            return Poll::Pending;
+        }
+        self.poll(task)
+    }
+}
+
+/// A safer version of `Vec<Waker>`. RefCell so we cannot accidentally borrow illegally.
+struct SafeWaiters(RefCell<Vec<Waker>>);
+
+/// Safety: this implements Sync even though it is not thread safe. This is okay, as we
+/// run only in a single thread in the BitBox02.
+unsafe impl Sync for SafeWaiters {}
+
+/// Wakers of the tasks currently waiting on an `option()`. There is at most one entry per task.
+static WAITERS: SafeWaiters = SafeWaiters(RefCell::new(Vec::new()));
+
 /// Implements the Option future, see `option()`.
 pub struct AsyncOption<'a, O>(&'a RefCell<Option<O>>);
 
 impl<O> core::future::Future for AsyncOption<'_, O> {
     type Output = O;
-    fn poll(self: Pin<&mut Self>, _cx: &mut Context<'_>) -> Poll<Self::Output> {
+    fn poll(self: Pin<&mut Self>, cx: &mut Context<'_>) -> Poll<Self::Output> {
         match self.0.borrow_mut().take() {
-            None => Poll::Pending,
+            None => {
+                let mut waiters = WAITERS.0.borrow_mut();
+                if !waiters.iter().any(|waker| waker.will_wake(cx.waker())) {
+                    // The buffer of the static vector is kept for good, it must not be in the
+                    // request arena.
+                    util::arena::permanent(|| waiters.push(cx.waker().clone()));
+                }
+                Poll::Pending
+            }
             Some(output) => Poll::Ready(output),
         }
     }
@@ -54,17 +134,67 @@ pub async fn option_no_screensaver<O>(opt: &RefCell<Option<O>>) -> O {
 
 /// Waits for an option to contain a value and returns that value, leaving `None` in its place.
 /// E.g. `assert_eq!(option(&Some(42)).await, 42)`.
+///
+/// The option must be set using `resolve()`, so that the waiting task is woken up.
 pub fn option<O>(option: &RefCell<Option<O>>) -> AsyncOption<O> {
     AsyncOption(option)
 }
 
+/// Resolves an `option()` future with the given value and wakes the tasks waiting on an option.
+/// As only a handful of tasks exist, all waiting tasks are woken; the ones whose option is still
+/// empty go back to waiting after one poll.
+pub fn resolve<O>(option: &RefCell<Option<O>>, value: O) {
+    *option.borrow_mut() = Some(value);
+    for waker in WAITERS.0.borrow_mut().drain(..) {
+        waker.wake();
+    }
+}
+
+/// Executor slot used by `block_on()`.
+static BLOCK_ON_SLOT: TaskSlot = TaskSlot::new();
+
 /// Polls a future until the result is available.
 pub fn block_on<O>(task: impl core::future::Future<Output = O>) -> O {
     let mut task: crate::bb02_async::Task<O> = alloc::boxed::Box::pin(task);
     loop {
         bitbox02::ui::screen_process();
-        if let Poll::Ready(result) = spin(&mut task) {
+        if let Poll::Ready(result) = BLOCK_ON_SLOT.poll(&mut task) {
             return result;
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_task_slot_polls_only_when_woken() {
+        static SLOT: TaskSlot = TaskSlot::new();
+        let cell: &'static RefCell<Option<u32>> = Box::leak(Box::new(RefCell::new(None)));
+
+        let mut task: Task<u32> = Box::pin(async move {
+            let first = option(cell).await;
+            let second = option(cell).await;
+            first + second
+        });
+
+        // Not spawned yet, so not polled.
+        assert_eq!(SLOT.spin(&mut task), Poll::Pending);
+        assert!(!SLOT.woken.load(Ordering::Relaxed));
+
+        SLOT.wake();
+        assert_eq!(SLOT.spin(&mut task), Poll::Pending);
+        // Waiting on the option, so it is not woken until the option is resolved.
+        assert!(!SLOT.woken.load(Ordering::Relaxed));
+        assert_eq!(SLOT.spin(&mut task), Poll::Pending);
+
+        resolve(cell, 1);
+        assert!(SLOT.woken.load(Ordering::Relaxed));
+        assert_eq!(SLOT.spin(&mut task), Poll::Pending);
+        assert!(!SLOT.woken.load(Ordering::Relaxed));
+
+        resolve(cell, 2);
+        assert_eq!(SLOT.spin(&mut task), Poll::Ready(3));
+    }
+}
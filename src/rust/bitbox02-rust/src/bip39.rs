@@ -0,0 +1,227 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//! Conversion between BIP39 entropy and the indices of the mnemonic words in the BIP39 wordlist,
+//! see https://github.com/bitcoin/bips/blob/master/bip-0039.mediawiki.
+//!
+//! Each word encodes 11 bits. The mnemonic encodes the entropy followed by a checksum, which is
+//! the first `entropy_bits / 32` bits of the SHA256 hash of the entropy.
+
+use alloc::vec::Vec;
+
+use sha2::{Digest, Sha256};
+
+const BITS_PER_WORD: usize = 11;
+
+/// Returns (entropy length in bytes, checksum length in bits) for a mnemonic of `num_words` words.
+fn lengths(num_words: usize) -> Result<(usize, usize), ()> {
+    if !(12..=24).contains(&num_words) || num_words % 3 != 0 {
+        return Err(());
+    }
+    let checksum_bits = num_words * BITS_PER_WORD / 33;
+    Ok((
+        (num_words * BITS_PER_WORD - checksum_bits) / 8,
+        checksum_bits,
+    ))
+}
+
+/// First byte of the hash of the entropy, containing the checksum in its top bits.
+fn checksum_byte(entropy: &[u8]) -> u8 {
+    Sha256::digest(entropy)[0]
+}
+
+/// Writes the bits encoded by the word indices to `out`, as far as they fit.
+fn pack(indices: &[u16], out: &mut [u8]) {
+    let out_bits = out.len() * 8;
+    for (word_pos, &index) in indices.iter().enumerate() {
+        for bit in 0..BITS_PER_WORD {
+            let pos = word_pos * BITS_PER_WORD + bit;
+            if pos >= out_bits {
+                return;
+            }
+            if index & (1 << (BITS_PER_WORD - 1 - bit)) != 0 {
+                out[pos / 8] |= 0x80 >> (pos % 8);
+            }
+        }
+    }
+}
+
+/// Encodes 16/20/24/28/32 bytes of entropy as the word indices of a 12/15/18/21/24 word mnemonic.
+pub fn entropy_to_indices(entropy: &[u8]) -> Result<zeroize::Zeroizing<Vec<u16>>, ()> {
+    let num_words = entropy.len() * 8 * 33 / 32 / BITS_PER_WORD;
+    let (entropy_len, checksum_bits) = lengths(num_words)?;
+    if entropy.len() != entropy_len {
+        return Err(());
+    }
+    let checksum = checksum_byte(entropy) >> (8 - checksum_bits);
+    let entropy_bits = entropy_len * 8;
+    let bit = |pos: usize| -> u16 {
+        if pos < entropy_bits {
+            ((entropy[pos / 8] >> (7 - pos % 8)) & 1) as u16
+        } else {
+            ((checksum >> (checksum_bits - 1 - (pos - entropy_bits))) & 1) as u16
+        }
+    };
+    Ok(zeroize::Zeroizing::new(
+        (0..num_words)
+            .map(|word_pos| {
+                (0..BITS_PER_WORD).fold(0, |index, b| {
+                    (index << 1) | bit(word_pos * BITS_PER_WORD + b)
+                })
+            })
+            .collect(),
+    ))
+}
+
+/// Decodes the word indices of a 12/15/18/21/24 word mnemonic to the entropy. Fails if the
+/// number of words is invalid, an index is out of range or the checksum does not match.
+pub fn indices_to_entropy(indices: &[u16]) -> Result<zeroize::Zeroizing<Vec<u8>>, ()> {
+    let (entropy_len, checksum_bits) = lengths(indices.len())?;
+    if indices
+        .iter()
+        .any(|&index| index >= bitbox02::keystore::BIP39_WORDLIST_LEN)
+    {
+        return Err(());
+    }
+    let mut entropy = zeroize::Zeroizing::new(vec![0u8; entropy_len]);
+    pack(indices, &mut entropy);
+    // The checksum fits into the last word.
+    let checksum = indices[indices.len() - 1] & ((1 << checksum_bits) - 1);
+    if checksum != (checksum_byte(&entropy) >> (8 - checksum_bits)) as u16 {
+        return Err(());
+    }
+    Ok(entropy)
+}
+
+/// Given the word indices of the first 11/14/17/20/23 words of a mnemonic, this function returns
+/// the indices of all words which complete it to a mnemonic with a valid checksum, in ascending
+/// order. The last word encodes the last 7/6/5/4/3 bits of the entropy and 4/5/6/7/8 bits of
+/// checksum, so there are 128/64/32/16/8 such words.
+pub fn lastword_choices(indices: &[u16]) -> Result<Vec<u16>, ()> {
+    let (entropy_len, checksum_bits) = lengths(indices.len() + 1)?;
+    if indices
+        .iter()
+        .any(|&index| index >= bitbox02::keystore::BIP39_WORDLIST_LEN)
+    {
+        return Err(());
+    }
+    let mut entropy = zeroize::Zeroizing::new(vec![0u8; entropy_len]);
+    pack(indices, &mut entropy);
+    let free_bits = BITS_PER_WORD - checksum_bits;
+    Ok((0..1u16 << free_bits)
+        .map(|i| {
+            // Set last 7/6/5/4/3 bits of the entropy to `i`.
+            let last = entropy.last_mut().unwrap();
+            *last = (*last & !((1u8 << free_bits) - 1)) | i as u8;
+            (i << checksum_bits) | (checksum_byte(&entropy) >> (8 - checksum_bits)) as u16
+        })
+        .collect())
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    use alloc::string::String;
+
+    fn words(indices: &[u16]) -> String {
+        indices
+            .iter()
+            .map(|&i| String::from(bitbox02::keystore::get_bip39_word(i).unwrap().as_str()))
+            .collect::<Vec<String>>()
+            .join(" ")
+    }
+
+    #[test]
+    fn test_entropy_to_indices() {
+        let tests: &[(&str, &str)] = &[
+            (
+                "00000000000000000000000000000000",
+                "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about",
+            ),
+            (
+                "80808080808080808080808080808080",
+                "letter advice cage absurd amount doctor acoustic avoid letter advice cage above",
+            ),
+            (
+                "9e885d952ad362caeb4efe34a8e91bd2",
+                "ozone drill grab fiber curtain grace pudding thank cruise elder eight picnic",
+            ),
+            (
+                "6610b25967cdcca9d59875f5cb50b0ea75433311869e930b",
+                "gravity machine north sort system female filter attitude volume fold club stay feature office ecology stable narrow fog",
+            ),
+            (
+                "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+                "zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo zoo vote",
+            ),
+        ];
+        for &(entropy_hex, mnemonic) in tests {
+            let entropy = hex::decode(entropy_hex).unwrap();
+            let indices = entropy_to_indices(&entropy).unwrap();
+            assert_eq!(words(&indices), mnemonic);
+            assert_eq!(
+                indices_to_entropy(&indices).unwrap().as_slice(),
+                &entropy[..]
+            );
+        }
+
+        assert_eq!(
+            entropy_to_indices(&[0u8; 16]).unwrap().as_slice(),
+            &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3]
+        );
+        assert!(entropy_to_indices(&[]).is_err());
+        assert!(entropy_to_indices(&[0u8; 15]).is_err());
+        assert!(entropy_to_indices(&[0u8; 17]).is_err());
+        assert!(entropy_to_indices(&[0u8; 36]).is_err());
+    }
+
+    #[test]
+    fn test_indices_to_entropy() {
+        assert_eq!(
+            indices_to_entropy(&[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3])
+                .unwrap()
+                .as_slice(),
+            &[0u8; 16]
+        );
+        // Invalid checksum.
+        assert!(indices_to_entropy(&[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0]).is_err());
+        // Invalid number of words.
+        assert!(indices_to_entropy(&[]).is_err());
+        assert!(indices_to_entropy(&[0; 11]).is_err());
+        assert!(indices_to_entropy(&[0; 13]).is_err());
+        assert!(indices_to_entropy(&[0; 27]).is_err());
+        // Index out of range.
+        assert!(indices_to_entropy(&[2048, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3]).is_err());
+    }
+
+    #[test]
+    fn test_lastword_choices() {
+        for num_words in [12, 15, 18, 21, 24] {
+            let indices: Vec<u16> = (0..num_words - 1).map(|i| (i * 307) % 2048).collect();
+            let choices = lastword_choices(&indices).unwrap();
+            let expected: Vec<u16> = (0..bitbox02::keystore::BIP39_WORDLIST_LEN)
+                .filter(|&last| {
+                    let mut mnemonic = indices.clone();
+                    mnemonic.push(last);
+                    indices_to_entropy(&mnemonic).is_ok()
+                })
+                .collect();
+            assert_eq!(choices.len(), 1 << (11 - num_words * 11 / 33));
+            assert_eq!(choices, expected);
+        }
+        assert!(lastword_choices(&[0; 12]).is_err());
+        assert!(lastword_choices(&[2048; 11]).is_err());
+    }
+}
@@ -38,7 +38,7 @@ pub async fn next_request(
         Some((&noise::OP_NOISE_MSG, encrypted_request)) => {
             let decrypted_request =
                 noise::decrypt(encrypted_request).or(Err(api::error::Error::NoiseDecrypt))?;
-            api::decode(&decrypted_request[..])
+            api::decode(decrypted_request)
         }
         _ => Err(api::error::Error::InvalidInput),
     }
@@ -55,8 +55,11 @@ pub fn encode(response: Response) -> Vec<u8> {
 }
 
 /// Decodes a protofbuf Request message.
-pub fn decode(input: &[u8]) -> Result<Request, Error> {
-    match pb::Request::decode(input) {
+///
+/// `bytes` fields which are decoded as `Bytes` (see tools/prost-build-proto) reference `input`
+/// instead of being copied.
+pub fn decode(input: Vec<u8>) -> Result<Request, Error> {
+    match pb::Request::decode(prost::bytes::Bytes::from(input)) {
         Ok(pb::Request {
             request: Some(request),
         }) => Ok(request),
@@ -211,7 +214,11 @@ async fn process_api(hal: &mut impl crate::hal::Hal, request: &Request) -> Resul
 /// `input` is a hww.proto Request message, protobuf encoded.
 /// Returns a protobuf encoded hww.proto Response message.
 pub async fn process(hal: &mut impl crate::hal::Hal, input: Vec<u8>) -> Vec<u8> {
-    let request = match decode(&input[..]) {
+    // The many short-lived allocations made while handling the request are served from the arena
+    // instead of fragmenting the heap. Allocations that are kept after the request must be made in
+    // `util::arena::permanent()`.
+    let _arena_scope = util::arena::Scope::enter();
+    let request = match decode(input) {
         Ok(request) => request,
         Err(err) => return encode(make_error(err)),
     };
@@ -224,3 +231,37 @@ pub async fn process(hal: &mut impl crate::hal::Hal, input: Vec<u8>) -> Vec<u8>
         Err(error) => encode(make_error(error)),
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_decode_references_input() {
+        let signature_script = vec![0x51; 300];
+        let input = pb::Request {
+            request: Some(Request::Btc(pb::BtcRequest {
+                request: Some(pb::btc_request::Request::PrevtxInput(
+                    pb::BtcPrevTxInputRequest {
+                        prev_out_hash: vec![1; 32].into(),
+                        prev_out_index: 1,
+                        signature_script: signature_script.clone().into(),
+                        sequence: 0xffffffff,
+                    },
+                )),
+            })),
+        }
+        .encode_to_vec();
+        let input_range = input.as_ptr_range();
+        match decode(input) {
+            Ok(Request::Btc(pb::BtcRequest {
+                request: Some(pb::btc_request::Request::PrevtxInput(request)),
+            })) => {
+                assert_eq!(&request.signature_script[..], &signature_script[..]);
+                // Not copied.
+                assert!(input_range.contains(&request.signature_script.as_ptr()));
+            }
+            _ => panic!("unexpected request"),
+        }
+    }
+}
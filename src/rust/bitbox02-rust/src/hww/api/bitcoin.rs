@@ -48,6 +48,7 @@ use pb::BtcCoin;
 use pb::BtcScriptConfig;
 
 use alloc::string::String;
+use alloc::vec::Vec;
 
 /// Like `hww::next_request`, but for Bitcoin requests/responses.
 pub async fn next_request(response: pb::btc_response::Response) -> Result<Request, Error> {
@@ -302,6 +303,82 @@ pub async fn process_pub(
     }
 }
 
+/// Upper bound for the encoded size of the elements of a `BtcPubRangeResponse`. The response has to
+/// fit into a single USB message of at most 7609 bytes (`USB_DATA_MAX_LEN`), which also holds the
+/// encryption overhead and the protobuf framing of the enclosing messages.
+const PUB_RANGE_MAX_RESPONSE_LEN: usize = 7000;
+
+/// Processes a range of non-displayed xpubs or single-sig addresses. The parent node is derived
+/// only once and each element is derived from it as a child, instead of deriving each element from
+/// the root.
+fn pub_range(request: &pb::BtcPubRangeRequest) -> Result<pb::btc_response::Response, Error> {
+    let coin = BtcCoin::try_from(request.coin)?;
+    coin_enabled(coin)?;
+    let coin_params = params::get(coin);
+    let output = request.output.as_ref().ok_or(Error::InvalidInput)?;
+    if request.count == 0 {
+        return Err(Error::InvalidInput);
+    }
+    let end_index = request
+        .start_index
+        .checked_add(request.count - 1)
+        .ok_or(Error::InvalidInput)?;
+    let hardened = request.start_index >= HARDENED;
+    if hardened != (end_index >= HARDENED) {
+        return Err(Error::InvalidInput);
+    }
+
+    let mut xpub_cache = crate::xpubcache::Bip32XpubCache::new();
+    // Hardened children can't be derived from the parent xpub.
+    if !hardened {
+        xpub_cache.add_keypath(&request.keypath);
+    }
+    let mut keypath = request.keypath.clone();
+    keypath.push(request.start_index);
+
+    let mut pubs = Vec::new();
+    let mut encoded_len: usize = 0;
+    for index in request.start_index..=end_index {
+        *keypath.last_mut().unwrap() = index;
+        let element = match *output {
+            pb::btc_pub_range_request::Output::XpubType(xpub_type) => {
+                let xpub_type = XPubType::try_from(xpub_type)?;
+                // Unusual keypaths need a confirmation, which a non-interactive call can't get.
+                keypath::validate_xpub(
+                    &keypath,
+                    coin_params.bip44_coin,
+                    coin_params.taproot_support,
+                )
+                .or(Err(Error::InvalidInput))?;
+                xpub_cache.get_xpub(&keypath)?.serialize_str(xpub_type)?
+            }
+            pb::btc_pub_range_request::Output::SimpleType(simple_type) => {
+                let simple_type = SimpleType::try_from(simple_type)?;
+                keypath::validate_address_simple(
+                    &keypath,
+                    coin_params.bip44_coin,
+                    simple_type,
+                    coin_params.taproot_support,
+                    keypath::ReceiveSpend::Receive,
+                )
+                .or(Err(Error::InvalidInput))?;
+                common::Payload::from_simple(&mut xpub_cache, coin_params, simple_type, &keypath)?
+                    .address(coin_params)?
+            }
+        };
+        // Field tag, length prefix and the string itself.
+        let element_len = 1 + prost::length_delimiter_len(element.len()) + element.len();
+        if encoded_len + element_len > PUB_RANGE_MAX_RESPONSE_LEN {
+            break;
+        }
+        encoded_len += element_len;
+        pubs.push(element);
+    }
+    Ok(pb::btc_response::Response::PubRange(
+        pb::BtcPubRangeResponse { pubs },
+    ))
+}
+
 /// Handle a nexted Bitcoin protobuf api call.
 pub async fn process_api(
     hal: &mut impl crate::hal::Hal,
@@ -315,6 +392,7 @@ pub async fn process_api(
             registration::process_register_script_config(hal, request).await
         }
         Request::SignMessage(ref request) => signmsg::process(hal, request).await,
+        Request::PubRange(ref request) => pub_range(request),
         // These are streamed asynchronously using the `next_request()` primitive in
         // bitcoin/signtx.rs and are not handled directly.
         Request::PrevtxInit(_)
@@ -1213,4 +1291,148 @@ mod tests {
             );
         }
     }
+
+    #[test]
+    fn test_pub_range() {
+        mock_unlocked_using_mnemonic(TEST_MNEMONIC, "");
+
+        // Addresses.
+        let req = pb::BtcPubRangeRequest {
+            coin: BtcCoin::Btc as _,
+            keypath: vec![49 + HARDENED, 0 + HARDENED, 0 + HARDENED, 0],
+            output: Some(pb::btc_pub_range_request::Output::SimpleType(
+                SimpleType::P2wpkhP2sh as _,
+            )),
+            start_index: 0,
+            count: 2,
+        };
+        assert_eq!(
+            block_on(process_api(&mut TestingHal::new(), &Request::PubRange(req))),
+            Ok(pb::btc_response::Response::PubRange(
+                pb::BtcPubRangeResponse {
+                    pubs: vec![
+                        "3BaL6XecvLAidPToUDhXo1zxD99ZUrErpd".into(),
+                        "3QRfCGEJVzvR1HN13kxB7xkuUtdEvG2orZ".into(),
+                    ],
+                }
+            )),
+        );
+
+        // Hardened xpubs.
+        let req = pb::BtcPubRangeRequest {
+            coin: BtcCoin::Btc as _,
+            keypath: vec![84 + HARDENED, 0 + HARDENED],
+            output: Some(pb::btc_pub_range_request::Output::XpubType(
+                XPubType::Xpub as _,
+            )),
+            start_index: HARDENED,
+            count: 2,
+        };
+        let expected_first = keystore::get_xpub(&[84 + HARDENED, 0 + HARDENED, 0 + HARDENED])
+            .unwrap()
+            .serialize_str(XPubType::Xpub)
+            .unwrap();
+        assert_eq!(
+            block_on(process_api(&mut TestingHal::new(), &Request::PubRange(req))),
+            Ok(pb::btc_response::Response::PubRange(pb::BtcPubRangeResponse {
+                pubs: vec![
+                    expected_first,
+                    "xpub6Bh4PT7iTyf6EHrFhc2ZaRYQxiLexYJQ7DtnNSNipD19JRV5jUW4gVHV9ouWvRY6DbbfyQhjP9E7LQ9QuR1SkPMnMi8NP3o2WtnWZim6Dqd".into(),
+                ],
+            })),
+        );
+
+        // A large range is truncated to fit into one response.
+        let req = pb::BtcPubRangeRequest {
+            coin: BtcCoin::Btc as _,
+            keypath: vec![86 + HARDENED, 0 + HARDENED, 0 + HARDENED, 1],
+            output: Some(pb::btc_pub_range_request::Output::SimpleType(
+                SimpleType::P2tr as _,
+            )),
+            start_index: 10,
+            count: 1000,
+        };
+        let response = match block_on(process_api(&mut TestingHal::new(), &Request::PubRange(req)))
+        {
+            Ok(pb::btc_response::Response::PubRange(response)) => response,
+            _ => panic!("unexpected response"),
+        };
+        assert!(response.pubs.len() > 50 && response.pubs.len() < 1000);
+        assert!(prost::Message::encoded_len(&response) <= PUB_RANGE_MAX_RESPONSE_LEN);
+        for (i, address) in response.pubs.iter().enumerate() {
+            assert_eq!(
+                address,
+                &derive_address_simple(
+                    BtcCoin::Btc,
+                    SimpleType::P2tr,
+                    &[86 + HARDENED, 0 + HARDENED, 0 + HARDENED, 1, 10 + i as u32],
+                )
+                .unwrap(),
+            );
+        }
+
+        // Invalid requests.
+        let valid = pb::BtcPubRangeRequest {
+            coin: BtcCoin::Btc as _,
+            keypath: vec![84 + HARDENED, 0 + HARDENED, 0 + HARDENED, 0],
+            output: Some(pb::btc_pub_range_request::Output::SimpleType(
+                SimpleType::P2wpkh as _,
+            )),
+            start_index: 0,
+            count: 1,
+        };
+        let invalid_requests = [
+            // No elements.
+            pb::BtcPubRangeRequest {
+                count: 0,
+                ..valid.clone()
+            },
+            // Address index out of range.
+            pb::BtcPubRangeRequest {
+                start_index: 9999,
+                count: 2,
+                ..valid.clone()
+            },
+            // Overflow.
+            pb::BtcPubRangeRequest {
+                start_index: u32::MAX,
+                count: 2,
+                ..valid.clone()
+            },
+            // Unusual xpub keypath.
+            pb::BtcPubRangeRequest {
+                keypath: vec![84 + HARDENED, 0 + HARDENED, 0 + HARDENED],
+                output: Some(pb::btc_pub_range_request::Output::XpubType(
+                    XPubType::Xpub as _,
+                )),
+                ..valid.clone()
+            },
+            // Mixed hardened and unhardened indices.
+            pb::BtcPubRangeRequest {
+                keypath: vec![84 + HARDENED, 0 + HARDENED],
+                output: Some(pb::btc_pub_range_request::Output::XpubType(
+                    XPubType::Xpub as _,
+                )),
+                start_index: HARDENED - 1,
+                count: 2,
+                ..valid.clone()
+            },
+            // No output.
+            pb::BtcPubRangeRequest {
+                output: None,
+                ..valid.clone()
+            },
+        ];
+        assert!(block_on(process_api(
+            &mut TestingHal::new(),
+            &Request::PubRange(valid)
+        ))
+        .is_ok());
+        for req in invalid_requests {
+            assert_eq!(
+                block_on(process_api(&mut TestingHal::new(), &Request::PubRange(req))),
+                Err(Error::InvalidInput),
+            );
+        }
+    }
 }
@@ -12,8 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+use bitbox02::sha256::Sha256;
 use sha2::Digest;
-use sha2::Sha256;
 
 use super::script::serialize_varint;
 
@@ -37,15 +37,20 @@ pub enum SortXpubs {
     Yes,
 }
 
-/// Creates a hash of this multisig config, useful for multisig account registration and
-/// identification. The individual params are not validated, they must be pre-validated!
-///
-/// If `sort_xpubs` is `SortXpubs::Yes`, the xpubs are sorted before hashing.
-/// The keypath is the account-level keypath.
-pub fn get_hash(
+fn serialize_xpubs(multisig: &Multisig) -> Result<Vec<Vec<u8>>, ()> {
+    multisig
+        .xpubs
+        .iter()
+        .map(|xpub| bip32::Xpub::from(xpub).serialize(None))
+        .collect()
+}
+
+/// Hashes the multisig config, with the xpubs already serialized in the order in which they are
+/// hashed.
+fn hash_serialized(
     coin: BtcCoin,
     multisig: &Multisig,
-    sort_xpubs: SortXpubs,
+    xpubs_serialized: &[Vec<u8>],
     keypath: &[u32],
 ) -> Result<Vec<u8>, ()> {
     let mut hasher = Sha256::new();
@@ -74,19 +79,11 @@ pub fn get_hash(
     }
     {
         // 4. num xpubs
-        let num: u32 = multisig.xpubs.len() as _;
+        let num: u32 = xpubs_serialized.len() as _;
         hasher.update(num.to_le_bytes());
     }
     {
         // 5. xpubs
-        let mut xpubs_serialized: Vec<Vec<u8>> = multisig
-            .xpubs
-            .iter()
-            .map(|xpub| bip32::Xpub::from(xpub).serialize(None))
-            .collect::<Result<Vec<Vec<u8>>, ()>>()?;
-        if let SortXpubs::Yes = sort_xpubs {
-            xpubs_serialized.sort();
-        }
         for xpub in xpubs_serialized.iter() {
             hasher.update(xpub);
         }
@@ -105,6 +102,24 @@ pub fn get_hash(
     Ok(hasher.finalize().as_slice().into())
 }
 
+/// Creates a hash of this multisig config, useful for multisig account registration and
+/// identification. The individual params are not validated, they must be pre-validated!
+///
+/// If `sort_xpubs` is `SortXpubs::Yes`, the xpubs are sorted before hashing.
+/// The keypath is the account-level keypath.
+pub fn get_hash(
+    coin: BtcCoin,
+    multisig: &Multisig,
+    sort_xpubs: SortXpubs,
+    keypath: &[u32],
+) -> Result<Vec<u8>, ()> {
+    let mut xpubs_serialized = serialize_xpubs(multisig)?;
+    if let SortXpubs::Yes = sort_xpubs {
+        xpubs_serialized.sort();
+    }
+    hash_serialized(coin, multisig, &xpubs_serialized, keypath)
+}
+
 /// Get the name of a registered multisig account. The individual params are not validated, they
 /// must be pre-validated!
 ///
@@ -112,17 +127,28 @@ pub fn get_hash(
 ///
 /// Returns the name of the registered multisig account if it exists or None otherwise.
 pub fn get_name(coin: BtcCoin, multisig: &Multisig, keypath: &[u32]) -> Result<Option<String>, ()> {
+    // The xpubs are serialized only once and reused for both lookups below.
+    let xpubs_serialized = serialize_xpubs(multisig)?;
     // First try using sorted xpubs (the default registration since v9.3.0).
-    if let Some(name) =
-        bitbox02::memory::multisig_get_by_hash(&get_hash(coin, multisig, SortXpubs::Yes, keypath)?)
-    {
+    let mut xpubs_sorted = xpubs_serialized.clone();
+    xpubs_sorted.sort();
+    if let Some(name) = bitbox02::memory::multisig_get_by_hash(&hash_serialized(
+        coin,
+        multisig,
+        &xpubs_sorted,
+        keypath,
+    )?) {
         return Ok(Some(name));
     }
+    if xpubs_sorted == xpubs_serialized {
+        // Already sorted, the unsorted hash is the same one we just looked up.
+        return Ok(None);
+    }
     // If that did not exist, try with unsorted xpubs for backwards compatibility.
-    Ok(bitbox02::memory::multisig_get_by_hash(&get_hash(
+    Ok(bitbox02::memory::multisig_get_by_hash(&hash_serialized(
         coin,
         multisig,
-        SortXpubs::No,
+        &xpubs_serialized,
         keypath,
     )?))
 }
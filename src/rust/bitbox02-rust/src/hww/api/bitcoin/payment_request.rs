@@ -173,13 +173,13 @@ pub fn tst_sign_payment_request(
 }
 
 fn ecdsa_verify(sig64: &[u8], msg32: &[u8], pubkey33: &[u8]) -> Result<(), ValidationError> {
-    let secp = secp256k1::Secp256k1::new();
     let pubkey = secp256k1::PublicKey::from_slice(pubkey33)
         .map_err(|_| ValidationError::InvalidSignature)?;
     let msg = secp256k1::Message::from_digest_slice(msg32).unwrap();
     let sig = secp256k1::ecdsa::Signature::from_compact(sig64)
         .map_err(|_| ValidationError::InvalidSignature)?;
-    secp.verify_ecdsa(&msg, &sig, &pubkey)
+    bitbox02::secp256k1::context()
+        .verify_ecdsa(&msg, &sig, &pubkey)
         .map_err(|_| ValidationError::InvalidSignature)
 }
 
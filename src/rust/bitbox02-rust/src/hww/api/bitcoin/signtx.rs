@@ -32,10 +32,11 @@ use alloc::vec::Vec;
 use pb::request::Request;
 use pb::response::Response;
 
+use bitbox02::sha256::Sha256;
 use pb::btc_script_config::SimpleType;
 use pb::btc_sign_init_request::FormatUnit;
 use pb::btc_sign_next_response::Type as NextType;
-use sha2::{Digest, Sha256};
+use sha2::Digest;
 
 use bitcoin::hashes::Hash;
 use bitcoin::key::TapTweak;
@@ -341,10 +342,10 @@ async fn handle_prevtx(
         });
 
         let prevtx_input = get_prevtx_input(input_index, prevtx_input_index, next_response).await?;
-        hasher.update(prevtx_input.prev_out_hash.as_slice());
+        hasher.update(&prevtx_input.prev_out_hash);
         hasher.update(prevtx_input.prev_out_index.to_le_bytes());
         hasher.update(serialize_varint(prevtx_input.signature_script.len() as u64).as_slice());
-        hasher.update(prevtx_input.signature_script.as_slice());
+        hasher.update(&prevtx_input.signature_script);
         hasher.update(prevtx_input.sequence.to_le_bytes());
     }
 
@@ -367,21 +368,44 @@ async fn handle_prevtx(
         }
         hasher.update(prevtx_output.value.to_le_bytes());
         hasher.update(serialize_varint(prevtx_output.pubkey_script.len() as u64).as_slice());
-        hasher.update(prevtx_output.pubkey_script.as_slice());
+        hasher.update(&prevtx_output.pubkey_script);
     }
 
     hasher.update(prevtx_init.locktime.to_le_bytes());
     // Hash again to produce the final double-hash.
     let hash = Sha256::digest(hasher.finalize());
-    if hash.as_slice() != input.prev_out_hash.as_slice() {
+    if hash[..] != input.prev_out_hash[..] {
         return Err(Error::InvalidInput);
     }
     Ok(())
 }
 
+/// Looks up the registered name of a multisig config in the already validated configs of this
+/// signing session, so the config hash does not have to be computed again.
+fn known_multisig_name(
+    known: &[ValidatedScriptConfigWithKeypath<'_>],
+    multisig: &pb::btc_script_config::Multisig,
+    keypath: &[u32],
+) -> Option<String> {
+    known.iter().find_map(|validated| match validated {
+        ValidatedScriptConfigWithKeypath {
+            keypath: known_keypath,
+            config:
+                ValidatedScriptConfig::Multisig {
+                    name,
+                    multisig: known_multisig,
+                },
+        } if *known_keypath == keypath && *known_multisig == multisig => Some(name.clone()),
+        _ => None,
+    })
+}
+
+/// `known` are script configs validated earlier in the same signing session. Their registered
+/// names are reused for identical configs.
 fn validate_script_config<'a>(
     script_config: &'a pb::BtcScriptConfigWithKeypath,
     coin_params: &super::params::Params,
+    known: &[ValidatedScriptConfigWithKeypath<'_>],
 ) -> Result<ValidatedScriptConfigWithKeypath<'a>, Error> {
     match script_config {
         pb::BtcScriptConfigWithKeypath {
@@ -392,8 +416,11 @@ fn validate_script_config<'a>(
             keypath,
         } => {
             super::multisig::validate(multisig, keypath)?;
-            let name = super::multisig::get_name(coin_params.coin, multisig, keypath)?
-                .ok_or(Error::InvalidInput)?;
+            let name = match known_multisig_name(known, multisig, keypath) {
+                Some(name) => name,
+                None => super::multisig::get_name(coin_params.coin, multisig, keypath)?
+                    .ok_or(Error::InvalidInput)?,
+            };
             Ok(ValidatedScriptConfigWithKeypath {
                 keypath,
                 config: ValidatedScriptConfig::Multisig { name, multisig },
@@ -445,10 +472,11 @@ fn validate_script_config<'a>(
 fn validate_script_configs<'a>(
     coin_params: &super::params::Params,
     script_configs: &'a [pb::BtcScriptConfigWithKeypath],
+    known: &[ValidatedScriptConfigWithKeypath<'_>],
 ) -> Result<Vec<ValidatedScriptConfigWithKeypath<'a>>, Error> {
     let validated: Vec<ValidatedScriptConfigWithKeypath> = script_configs
         .iter()
-        .map(|config| validate_script_config(config, coin_params))
+        .map(|config| validate_script_config(config, coin_params, known))
         .collect::<Result<Vec<ValidatedScriptConfigWithKeypath>, Error>>()?;
     Ok(validated)
 }
@@ -462,7 +490,7 @@ async fn validate_input_script_configs<'a>(
         return Err(Error::InvalidInput);
     }
 
-    let script_configs = validate_script_configs(coin_params, script_configs)?;
+    let script_configs = validate_script_configs(coin_params, script_configs, &[])?;
 
     // If there are multiple script configs, only SimpleType (single sig, no additional inputs)
     // configs are allowed, so e.g. mixing p2wpkh and pw2wpkh-p2sh is okay, but mixing p2wpkh with
@@ -678,8 +706,11 @@ async fn _process(
     }
     let validated_script_configs =
         validate_input_script_configs(hal, coin_params, &request.script_configs).await?;
-    let validated_output_script_configs =
-        validate_script_configs(coin_params, &request.output_script_configs)?;
+    let validated_output_script_configs = validate_script_configs(
+        coin_params,
+        &request.output_script_configs,
+        &validated_script_configs,
+    )?;
 
     let mut xpub_cache = Bip32XpubCache::new();
     setup_xpub_cache(&mut xpub_cache, &request.script_configs);
@@ -746,7 +777,7 @@ async fn _process(
         // https://github.com/bitcoin/bips/blob/master/bip-0143.mediawiki
         // point 2: accumulate hashPrevouts
         // ANYONECANPAY not supported.
-        hasher_prevouts.update(tx_input.prev_out_hash.as_slice());
+        hasher_prevouts.update(&tx_input.prev_out_hash);
         hasher_prevouts.update(tx_input.prev_out_index.to_le_bytes());
 
         // https://github.com/bitcoin/bips/blob/master/bip-0143.mediawiki
@@ -783,7 +814,7 @@ async fn _process(
 
         if let Some(ref mut silent_payment) = silent_payment {
             let keypair = bitcoin::key::UntweakedKeypair::from_seckey_slice(
-                silent_payment.get_secp(),
+                bitbox02::secp256k1::context(),
                 &bitbox02::keystore::secp256k1_get_private_key(&tx_input.keypath)?,
             )
             .unwrap();
@@ -792,7 +823,7 @@ async fn _process(
             // tweak.
             let private_key = if is_taproot(script_config_account) {
                 keypair
-                    .tap_tweak(silent_payment.get_secp(), None)
+                    .tap_tweak(bitbox02::secp256k1::context(), None)
                     .to_inner()
                     .secret_key()
             } else {
@@ -1189,7 +1220,7 @@ async fn _process(
                 version: request.version,
                 hash_prevouts: Sha256::digest(hash_prevouts).into(),
                 hash_sequence: Sha256::digest(hash_sequence).into(),
-                outpoint_hash: tx_input.prev_out_hash.as_slice().try_into().unwrap(),
+                outpoint_hash: tx_input.prev_out_hash[..].try_into().unwrap(),
                 outpoint_index: tx_input.prev_out_index,
                 sighash_script: &sighash_script(
                     &mut xpub_cache,
@@ -1318,7 +1349,8 @@ mod tests {
                                 0x45, 0x17, 0x74, 0x50, 0x1b, 0xaf, 0xdf, 0xf7, 0x46, 0x9, 0xe,
                                 0x6, 0x16, 0xd9, 0x5e, 0xd0, 0x80, 0xd7, 0x82, 0x9a, 0xfe, 0xa2,
                                 0xbd, 0x97, 0x8a, 0xf8, 0x11, 0xf4, 0x5e, 0x43, 0x81, 0x39,
-                            ],
+                            ]
+                            .into(),
                             prev_out_index: 1,
                             prev_out_value: 1010000000,
                             sequence: 0xffffffff,
@@ -1334,9 +1366,10 @@ mod tests {
                                     0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
                                     0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
                                     0x74, 0x74,
-                                ],
+                                ]
+                                .into(),
                                 prev_out_index: 3,
-                                signature_script: b"signature script".to_vec(),
+                                signature_script: b"signature script".to_vec().into(),
                                 sequence: 0xffffffff - 2,
                             },
                             pb::BtcPrevTxInputRequest {
@@ -1345,20 +1378,21 @@ mod tests {
                                     0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
                                     0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
                                     0x75, 0x75,
-                                ],
+                                ]
+                                .into(),
                                 prev_out_index: 23,
-                                signature_script: b"signature script 2".to_vec(),
+                                signature_script: b"signature script 2".to_vec().into(),
                                 sequence: 123456,
                             },
                         ],
                         prevtx_outputs: vec![
                             pb::BtcPrevTxOutputRequest {
                                 value: 101000000, // btc 1.01
-                                pubkey_script: b"pubkey script".to_vec(),
+                                pubkey_script: b"pubkey script".to_vec().into(),
                             },
                             pb::BtcPrevTxOutputRequest {
                                 value: 1010000000, // btc 10.1
-                                pubkey_script: b"pubkey script 2".to_vec(),
+                                pubkey_script: b"pubkey script 2".to_vec().into(),
                             },
                         ],
                         prevtx_locktime: 0,
@@ -1370,7 +1404,8 @@ mod tests {
                                 0x40, 0x9b, 0x4f, 0x56, 0xca, 0x9f, 0x6, 0xcb, 0x88, 0x28, 0x3,
                                 0xad, 0x55, 0x4b, 0xeb, 0x1d, 0x9e, 0xf8, 0x78, 0x7, 0xf0, 0x52,
                                 0x29, 0xe7, 0x55, 0x15, 0xe4, 0xb2, 0xaa, 0x87, 0x69, 0x1d,
-                            ],
+                            ]
+                            .into(),
                             prev_out_index: 0,
                             prev_out_value: 1020000000, // btc 10.2, matches prevout tx output at index 0.
                             sequence: 0xffffffff,
@@ -1384,14 +1419,15 @@ mod tests {
                                 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
                                 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
                                 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-                            ],
+                            ]
+                            .into(),
                             prev_out_index: 3,
-                            signature_script: b"signature script".to_vec(),
+                            signature_script: b"signature script".to_vec().into(),
                             sequence: 0xffffffff - 2,
                         }],
                         prevtx_outputs: vec![pb::BtcPrevTxOutputRequest {
                             value: 1020000000, // btc 10.2
-                            pubkey_script: b"pubkey script".to_vec(),
+                            pubkey_script: b"pubkey script".to_vec().into(),
                         }],
                         prevtx_locktime: 87654,
                         host_nonce: None,
@@ -1475,7 +1511,8 @@ mod tests {
                             0x41, 0x3b, 0x8e, 0x74, 0x05, 0x15, 0x96, 0x6b, 0x20, 0x2b, 0x24, 0xc3,
                             0x19, 0xfc, 0xf3, 0x5f, 0xc5, 0x37, 0x6e, 0xb2, 0x71, 0x95, 0xb8, 0x76,
                             0x62, 0x9a, 0x44, 0x1d, 0x19, 0xaa, 0x6c, 0x0f,
-                        ],
+                        ]
+                        .into(),
                         prev_out_index: 0,
                         prev_out_value: 100000, // btc 0.001
                         sequence: 0xffffffff - 1,
@@ -1489,14 +1526,15 @@ mod tests {
                             0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
                             0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
                             0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
-                        ],
+                        ]
+                        .into(),
                         prev_out_index: 3,
-                        signature_script: b"signature script".to_vec(),
+                        signature_script: b"signature script".to_vec().into(),
                         sequence: 0xffffffff - 2,
                     }],
                     prevtx_outputs: vec![pb::BtcPrevTxOutputRequest {
                         value: 100000, // btc 0.001
-                        pubkey_script: b"pubkey script".to_vec(),
+                        pubkey_script: b"pubkey script".to_vec().into(),
                     }],
                     prevtx_locktime: 0,
                     host_nonce: None,
@@ -2285,7 +2323,10 @@ mod tests {
                     transaction.borrow_mut().inputs[0].input.prev_out_value += 1;
                 }
                 TestCase::WrongPrevoutHash => {
-                    transaction.borrow_mut().inputs[0].input.prev_out_hash[0] += 1;
+                    let mut tx = transaction.borrow_mut();
+                    let mut prev_out_hash = tx.inputs[0].input.prev_out_hash.to_vec();
+                    prev_out_hash[0] += 1;
+                    tx.inputs[0].input.prev_out_hash = prev_out_hash.into();
                 }
                 TestCase::WrongPrevoutIndex => {
                     let mut tx = transaction.borrow_mut();
@@ -27,6 +27,20 @@ use super::Error;
 use pb::cardano_request::Request;
 use pb::cardano_response::Response;
 
+/// Like `hww::next_request`, but for Cardano requests/responses.
+pub async fn next_request(response: Response) -> Result<Request, Error> {
+    let request = crate::hww::next_request(pb::response::Response::Cardano(pb::CardanoResponse {
+        response: Some(response),
+    }))
+    .await?;
+    match request {
+        pb::request::Request::Cardano(pb::CardanoRequest {
+            request: Some(request),
+        }) => Ok(request),
+        _ => Err(Error::InvalidState),
+    }
+}
+
 /// Handle a Cardano protobuf api call.
 pub async fn process_api(
     hal: &mut impl crate::hal::Hal,
@@ -36,5 +50,8 @@ pub async fn process_api(
         Request::Xpubs(ref request) => xpubs::process(request),
         Request::Address(ref request) => address::process(hal, request).await,
         Request::SignTransaction(ref request) => sign_transaction::process(hal, request).await,
+        // These are streamed using the `next_request()` primitive in cardano/sign_transaction.rs
+        // and are not handled directly.
+        Request::Outputs(_) | Request::AssetGroups(_) => Err(Error::InvalidState),
     }
 }
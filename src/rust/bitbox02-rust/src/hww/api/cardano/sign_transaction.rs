@@ -26,10 +26,15 @@ use blake2::{
     Blake2bVar,
 };
 
+use minicbor::encode::{Encoder, Write};
+
 use crate::hal::Ui;
 use crate::workflow::{confirm, transaction};
 
+use pb::cardano_request::Request;
 use pb::cardano_response::Response;
+use pb::cardano_sign_transaction_next_response::Type as NextType;
+use pb::cardano_sign_transaction_request::{AssetGroup, Output};
 use pb::cardano_sign_transaction_response::ShelleyWitness;
 use pb::{CardanoNetwork, CardanoScriptConfig};
 
@@ -56,8 +61,12 @@ fn format_value(params: &params::Params, value: u64) -> String {
     )
 }
 
-fn make_shelley_witness(keypath: &[u32], tx_body_hash: &[u8; 32]) -> Result<ShelleyWitness, ()> {
-    let result = ed25519::sign(keypath, tx_body_hash)?;
+fn make_shelley_witness(
+    xprv_cache: &mut ed25519::XprvCache,
+    keypath: &[u32],
+    tx_body_hash: &[u8; 32],
+) -> Result<ShelleyWitness, ()> {
+    let result = xprv_cache.sign(keypath, tx_body_hash)?;
     Ok(ShelleyWitness {
         public_key: result.public_key.as_ref().to_vec(),
         signature: result.signature.to_vec(),
@@ -127,6 +136,157 @@ fn validate_asset_groups(
     Ok(())
 }
 
+/// Verifies an output. Change outputs are validated, recipient outputs are confirmed by the user
+/// and their value is added to `total`. Returns true for recipient outputs, whose tokens must be
+/// confirmed by the user as well, see `confirm_tokens()`.
+async fn verify_output(
+    hal: &mut impl crate::hal::Hal,
+    params: &params::Params,
+    bip44_account: u32,
+    output: &Output,
+    total: &mut u64,
+) -> Result<bool, Error> {
+    super::address::decode_payment_address(params, &output.encoded_address)?;
+
+    match output.script_config {
+        Some(ref script_config) => match script_config {
+            CardanoScriptConfig {
+                config: Some(ref config),
+            } => {
+                let encoded_address = super::address::validate_and_encode_payment_address(
+                    params,
+                    config,
+                    Some(bip44_account),
+                )?;
+                if encoded_address != output.encoded_address {
+                    return Err(Error::InvalidInput);
+                }
+                Ok(false)
+            }
+            _ => Err(Error::InvalidInput),
+        },
+        None => {
+            let formatted_value = format_value(params, output.value);
+            hal.ui()
+                .verify_recipient(&output.encoded_address, &formatted_value)
+                .await?;
+            *total += output.value;
+            Ok(true)
+        }
+    }
+}
+
+async fn confirm_tokens(
+    hal: &mut impl crate::hal::Hal,
+    asset_group: &AssetGroup,
+) -> Result<(), Error> {
+    for token in asset_group.tokens.iter() {
+        hal.ui()
+            .confirm(&confirm::Params {
+                title: "Send token",
+                body: &format!(
+                    "Amount: {}. Asset: {}",
+                    util::decimal::format(token.value, 0),
+                    format_asset(&asset_group.policy_id, &token.asset_name),
+                ),
+                accept_is_nextarrow: true,
+                scrollable: true,
+                ..Default::default()
+            })
+            .await?;
+    }
+    Ok(())
+}
+
+/// Requests the asset groups of a streamed output from the host in batches, verifies and encodes
+/// them. The policy ids must be strictly increasing, so duplicate assets can be detected without
+/// keeping the previous asset groups around.
+async fn stream_asset_groups<W: Write>(
+    hal: &mut impl crate::hal::Hal,
+    encoder: &mut Encoder<W>,
+    output_index: u32,
+    num_asset_groups: u32,
+    confirm: bool,
+) -> Result<(), Error> {
+    let mut previous_policy_id: Vec<u8> = Vec::new();
+    let mut asset_group_index: u32 = 0;
+    while asset_group_index < num_asset_groups {
+        let request = super::next_request(Response::SignTransactionNext(
+            pb::CardanoSignTransactionNextResponse {
+                r#type: NextType::AssetGroups as _,
+                output_index,
+                asset_group_index,
+            },
+        ))
+        .await?;
+        let asset_groups = match request {
+            Request::AssetGroups(pb::CardanoSignTransactionAssetGroupsRequest { asset_groups }) => {
+                asset_groups
+            }
+            _ => return Err(Error::InvalidState),
+        };
+        if asset_groups.is_empty()
+            || asset_groups.len() > (num_asset_groups - asset_group_index) as usize
+        {
+            return Err(Error::InvalidInput);
+        }
+        validate_asset_groups(&asset_groups)?;
+        for asset_group in asset_groups.iter() {
+            if asset_group.policy_id <= previous_policy_id {
+                return Err(Error::InvalidInput);
+            }
+            previous_policy_id.clone_from(&asset_group.policy_id);
+            if confirm {
+                confirm_tokens(hal, asset_group).await?;
+            }
+            cbor::encode_asset_group(encoder, asset_group)?;
+            asset_group_index += 1;
+        }
+    }
+    Ok(())
+}
+
+/// Requests the outputs from the host in batches, verifies and encodes them. Only one batch of
+/// outputs and one batch of asset groups are held in memory at a time.
+async fn stream_outputs<W: Write>(
+    hal: &mut impl crate::hal::Hal,
+    params: &params::Params,
+    bip44_account: u32,
+    num_outputs: u32,
+    encoder: &mut Encoder<W>,
+    total: &mut u64,
+) -> Result<(), Error> {
+    let mut output_index: u32 = 0;
+    while output_index < num_outputs {
+        let request = super::next_request(Response::SignTransactionNext(
+            pb::CardanoSignTransactionNextResponse {
+                r#type: NextType::Outputs as _,
+                output_index,
+                asset_group_index: 0,
+            },
+        ))
+        .await?;
+        let outputs = match request {
+            Request::Outputs(pb::CardanoSignTransactionOutputsRequest { outputs }) => outputs,
+            _ => return Err(Error::InvalidState),
+        };
+        if outputs.is_empty() || outputs.len() > (num_outputs - output_index) as usize {
+            return Err(Error::InvalidInput);
+        }
+        for output in outputs.iter() {
+            if !output.asset_groups.is_empty() {
+                return Err(Error::InvalidInput);
+            }
+            let confirm = verify_output(hal, params, bip44_account, output, total).await?;
+            cbor::encode_output(params, encoder, output, output.num_asset_groups as _)?;
+            stream_asset_groups(hal, encoder, output_index, output.num_asset_groups, confirm)
+                .await?;
+            output_index += 1;
+        }
+    }
+    Ok(())
+}
+
 async fn _process(
     hal: &mut impl crate::hal::Hal,
     request: &pb::CardanoSignTransactionRequest,
@@ -218,55 +378,47 @@ async fn _process(
         signing_keypaths.push(&withdrawal.keypath);
     }
 
+    // The transaction body is hashed while the outputs are verified, so that streamed outputs
+    // do not need to be kept in memory.
+    let mut hasher = Blake2bVar::new(32).unwrap();
+    let mut encoder = Encoder::new(cbor::HashedWriter::new(&mut hasher));
+    let num_outputs = if request.num_outputs == 0 {
+        request.outputs.len() as u32
+    } else {
+        request.num_outputs
+    };
+    cbor::encode_transaction_body_start(request, num_outputs as _, &mut encoder)?;
+
     let mut total: u64 = 0;
 
-    for output in request.outputs.iter() {
-        super::address::decode_payment_address(params, &output.encoded_address)?;
-
-        validate_asset_groups(&output.asset_groups)?;
-
-        match output.script_config {
-            Some(ref script_config) => match script_config {
-                CardanoScriptConfig {
-                    config: Some(ref config),
-                } => {
-                    let encoded_address = super::address::validate_and_encode_payment_address(
-                        params,
-                        config,
-                        Some(bip44_account),
-                    )?;
-                    if encoded_address != output.encoded_address {
-                        return Err(Error::InvalidInput);
-                    }
-                }
-                _ => return Err(Error::InvalidInput),
-            },
-            None => {
-                let formatted_value = format_value(params, output.value);
-                hal.ui()
-                    .verify_recipient(&output.encoded_address, &formatted_value)
-                    .await?;
-                total += output.value;
-
-                for asset_group in output.asset_groups.iter() {
-                    for token in asset_group.tokens.iter() {
-                        hal.ui()
-                            .confirm(&confirm::Params {
-                                title: "Send token",
-                                body: &format!(
-                                    "Amount: {}. Asset: {}",
-                                    util::decimal::format(token.value, 0),
-                                    format_asset(&asset_group.policy_id, &token.asset_name),
-                                ),
-                                accept_is_nextarrow: true,
-                                scrollable: true,
-                                ..Default::default()
-                            })
-                            .await?;
-                    }
+    if request.num_outputs == 0 {
+        for output in request.outputs.iter() {
+            if output.num_asset_groups != 0 {
+                return Err(Error::InvalidInput);
+            }
+            validate_asset_groups(&output.asset_groups)?;
+            let confirm = verify_output(hal, params, bip44_account, output, &mut total).await?;
+            cbor::encode_output(params, &mut encoder, output, output.asset_groups.len() as _)?;
+            for asset_group in output.asset_groups.iter() {
+                if confirm {
+                    confirm_tokens(hal, asset_group).await?;
                 }
+                cbor::encode_asset_group(&mut encoder, asset_group)?;
             }
         }
+    } else {
+        if !request.outputs.is_empty() {
+            return Err(Error::InvalidInput);
+        }
+        stream_outputs(
+            hal,
+            params,
+            bip44_account,
+            request.num_outputs,
+            &mut encoder,
+            &mut total,
+        )
+        .await?;
     }
 
     if total == 0 {
@@ -292,8 +444,8 @@ async fn _process(
     hal.ui().status("Transaction\nconfirmed", true).await;
 
     let tx_body_hash: [u8; 32] = {
-        let mut hasher = Blake2bVar::new(32).unwrap();
-        cbor::encode_transaction_body(request, cbor::HashedWriter::new(&mut hasher))?;
+        cbor::encode_transaction_body_end(request, &mut encoder)?;
+        drop(encoder);
 
         let mut out = [0u8; 32];
         hasher.finalize_variable(&mut out).or(Err(Error::Generic))?;
@@ -303,9 +455,16 @@ async fn _process(
     signing_keypaths.sort();
     signing_keypaths.dedup();
 
+    // The inputs usually belong to one or a few accounts, so the account xprvs are derived only
+    // once for all witnesses.
+    let mut xprv_cache = ed25519::XprvCache::new();
     let mut shelley_witnesses: Vec<ShelleyWitness> = Vec::with_capacity(signing_keypaths.len());
     for keypath in signing_keypaths {
-        shelley_witnesses.push(make_shelley_witness(keypath, &tx_body_hash)?);
+        shelley_witnesses.push(make_shelley_witness(
+            &mut xprv_cache,
+            keypath,
+            &tx_body_hash,
+        )?);
     }
 
     Ok(Response::SignTransaction(
@@ -399,6 +558,7 @@ mod tests {
                     value: 1000000,
                     script_config: None,
                     asset_groups: vec![],
+                    ..Default::default()
                 },
                 pb::cardano_sign_transaction_request::Output {
                     // Byron Yoroi style address
@@ -406,6 +566,7 @@ mod tests {
                     value: 2000000,
                     script_config: None,
                     asset_groups: vec![],
+                    ..Default::default()
                 },
                 pb::cardano_sign_transaction_request::Output {
                     // Byron Dadedalus style address
@@ -413,6 +574,7 @@ mod tests {
                     value: 3000000,
                     script_config: None,
                     asset_groups: vec![],
+                    ..Default::default()
                 },
                 // change
                 pb::cardano_sign_transaction_request::Output {
@@ -425,6 +587,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 170499,
@@ -509,6 +672,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 191681,
@@ -615,6 +779,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 191681,
@@ -702,6 +867,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 191681,
@@ -788,6 +954,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 175157,
@@ -862,6 +1029,7 @@ mod tests {
                     value: 1000000,
                     script_config: None,
                     asset_groups: vec![],
+                    ..Default::default()
                 },
                 // change
                 pb::cardano_sign_transaction_request::Output {
@@ -874,6 +1042,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 170499,
@@ -911,6 +1080,7 @@ mod tests {
                     value: 1000000,
                     script_config: None,
                     asset_groups: vec![],
+                    ..Default::default()
                 },
                 // change
                 pb::cardano_sign_transaction_request::Output {
@@ -923,6 +1093,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 170499,
@@ -989,6 +1160,7 @@ mod tests {
                     value: 1000000,
                     script_config: None,
                     asset_groups: vec![],
+                    ..Default::default()
                 },
                 // change
                 pb::cardano_sign_transaction_request::Output {
@@ -1001,6 +1173,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 170499,
@@ -1036,6 +1209,7 @@ mod tests {
                     value: 1000000,
                     script_config: None,
                     asset_groups: vec![],
+                    ..Default::default()
                 },
                 // change
                 pb::cardano_sign_transaction_request::Output {
@@ -1048,6 +1222,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 170499,
@@ -1108,6 +1283,7 @@ mod tests {
                             ],
                         },
                     ],
+                    ..Default::default()
                 },
                 // change
                 pb::cardano_sign_transaction_request::Output {
@@ -1130,6 +1306,7 @@ mod tests {
                             ],
                         },
                     ],
+                    ..Default::default()
                 },
             ],
             fee: 170499,
@@ -1189,6 +1366,153 @@ mod tests {
         );
     }
 
+    /// Responds to the device's requests for streamed outputs and asset groups, using batches of
+    /// up to `batch_size` items.
+    fn mock_host_streaming(outputs: Vec<Output>, batch_size: usize) {
+        *crate::hww::MOCK_NEXT_REQUEST.0.borrow_mut() = Some(Box::new(move |response| {
+            let next = match response {
+                pb::response::Response::Cardano(pb::CardanoResponse {
+                    response: Some(Response::SignTransactionNext(next)),
+                }) => next,
+                _ => panic!("unexpected response"),
+            };
+            let output_index = next.output_index as usize;
+            let request = match NextType::try_from(next.r#type).unwrap() {
+                NextType::Outputs => {
+                    let end = (output_index + batch_size).min(outputs.len());
+                    Request::Outputs(pb::CardanoSignTransactionOutputsRequest {
+                        outputs: outputs[output_index..end]
+                            .iter()
+                            .map(|output| Output {
+                                num_asset_groups: output.asset_groups.len() as _,
+                                asset_groups: vec![],
+                                ..output.clone()
+                            })
+                            .collect(),
+                    })
+                }
+                NextType::AssetGroups => {
+                    let asset_groups = &outputs[output_index].asset_groups;
+                    let start = next.asset_group_index as usize;
+                    let end = (start + batch_size).min(asset_groups.len());
+                    Request::AssetGroups(pb::CardanoSignTransactionAssetGroupsRequest {
+                        asset_groups: asset_groups[start..end].to_vec(),
+                    })
+                }
+            };
+            Ok(pb::request::Request::Cardano(pb::CardanoRequest {
+                request: Some(request),
+            }))
+        }));
+    }
+
+    fn make_asset_group(policy_id_byte: u8, asset_names: &[&[u8]]) -> AssetGroup {
+        AssetGroup {
+            policy_id: vec![policy_id_byte; 28],
+            tokens: asset_names
+                .iter()
+                .map(
+                    |asset_name| pb::cardano_sign_transaction_request::asset_group::Token {
+                        asset_name: asset_name.to_vec(),
+                        value: asset_name.len() as _,
+                    },
+                )
+                .collect(),
+        }
+    }
+
+    /// Streaming the outputs results in the same screens and signature as sending them all at
+    /// once.
+    #[test]
+    fn test_sign_tx_streamed() {
+        let outputs = vec![
+            Output {
+                encoded_address: "addr1q9qfllpxg2vu4lq6rnpel4pvpp5xnv3kvvgtxk6k6wp4ff89xrhu8jnu3p33vnctc9eklee5dtykzyag5penc6dcmakqsqqgpt".into(),
+                value: 1000000,
+                asset_groups: vec![
+                    make_asset_group(1, &[b"a", b"bb"]),
+                    make_asset_group(2, &[b""]),
+                    make_asset_group(3, &[b"ccc"]),
+                ],
+                ..Default::default()
+            },
+            Output {
+                encoded_address: "Ae2tdPwUPEZFRbyhz3cpfC2CumGzNkFBN2L42rcUc2yjQpEkxDbkPodpMAi".into(),
+                value: 2000000,
+                ..Default::default()
+            },
+            // change
+            Output {
+                encoded_address: "addr1q90tlskd4mh5kncmul7vx887j30tjtfgvap5n0g0rf9qqc7znmndrdhe7rwvqkw5c7mqnp4a3yflnvu6kff7l5dungvqmvu6hs".into(),
+                value: 4829501,
+                script_config: Some(CardanoScriptConfig {
+                    config: Some(pb::cardano_script_config::Config::PkhSkh(
+                        pb::cardano_script_config::PkhSkh {
+                            keypath_payment: vec![1852 + HARDENED, 1815 + HARDENED, HARDENED, 0, 0],
+                            keypath_stake: vec![1852 + HARDENED, 1815 + HARDENED, HARDENED, 2, 0],
+                        },
+                    )),
+                }),
+                asset_groups: vec![make_asset_group(1, &[b"a"])],
+                ..Default::default()
+            },
+        ];
+        let tx = pb::CardanoSignTransactionRequest {
+            network: CardanoNetwork::CardanoMainnet as _,
+            inputs: vec![pb::cardano_sign_transaction_request::Input {
+                keypath: vec![1852 + HARDENED, 1815 + HARDENED, HARDENED, 0, 0],
+                prev_out_hash: b"\x59\x86\x4e\xe7\x3c\xa5\xd9\x10\x98\xa3\x2b\x3c\xe9\x81\x1b\xac\x19\x96\xdc\xba\xef\xa6\xb6\x24\x7d\xca\xaf\xb5\x77\x9c\x25\x38".to_vec(),
+                prev_out_index: 0,
+            }],
+            outputs: outputs.clone(),
+            fee: 170499,
+            ttl: 41115811,
+            ..Default::default()
+        };
+
+        mock_unlocked();
+        let mut mock_hal = TestingHal::new();
+        let expected_result = block_on(process(&mut mock_hal, &tx)).unwrap();
+        let expected_screens = mock_hal.ui.screens;
+
+        for batch_size in [1, 2, 10] {
+            mock_host_streaming(outputs.clone(), batch_size);
+            let streamed_tx = pb::CardanoSignTransactionRequest {
+                outputs: vec![],
+                num_outputs: outputs.len() as _,
+                ..tx.clone()
+            };
+            let mut mock_hal = TestingHal::new();
+            let result = block_on(process(&mut mock_hal, &streamed_tx)).unwrap();
+            assert_eq!(result, expected_result);
+            assert_eq!(mock_hal.ui.screens, expected_screens);
+        }
+
+        // Asset groups not sorted by policy id.
+        let mut unsorted_outputs = outputs.clone();
+        unsorted_outputs[0].asset_groups.swap(0, 1);
+        mock_host_streaming(unsorted_outputs, 2);
+        let streamed_tx = pb::CardanoSignTransactionRequest {
+            outputs: vec![],
+            num_outputs: outputs.len() as _,
+            ..tx.clone()
+        };
+        assert_eq!(
+            block_on(process(&mut TestingHal::new(), &streamed_tx)),
+            Err(Error::InvalidInput)
+        );
+
+        // Outputs must not be streamed and sent in the initial request at the same time.
+        let invalid_tx = pb::CardanoSignTransactionRequest {
+            num_outputs: outputs.len() as _,
+            ..tx.clone()
+        };
+        assert_eq!(
+            block_on(process(&mut TestingHal::new(), &invalid_tx)),
+            Err(Error::InvalidInput)
+        );
+    }
+
     // Test a transaction with an unusually high fee.
     #[test]
     fn test_high_fee_warning() {
@@ -1205,6 +1529,7 @@ mod tests {
                     value: 1000000,
                     script_config: None,
                     asset_groups: vec![],
+                    ..Default::default()
                 },
                 // change
                 pb::cardano_sign_transaction_request::Output {
@@ -1217,6 +1542,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 170499,
@@ -1247,6 +1573,7 @@ mod tests {
                     value: 1000000,
                     script_config: None,
                     asset_groups: vec![],
+                    ..Default::default()
                 },
                 // change
                 pb::cardano_sign_transaction_request::Output {
@@ -1259,6 +1586,7 @@ mod tests {
                         }))
                     }),
                     asset_groups: vec![],
+                    ..Default::default()
                 },
             ],
             fee: 170499,
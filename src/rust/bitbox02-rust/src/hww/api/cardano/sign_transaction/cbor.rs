@@ -21,7 +21,9 @@ use alloc::vec::Vec;
 use digest::Update;
 use minicbor::encode::{Encoder, Write};
 
-use pb::cardano_sign_transaction_request::{certificate, Certificate, Withdrawal};
+use pb::cardano_sign_transaction_request::{
+    certificate, AssetGroup, Certificate, Output, Withdrawal,
+};
 
 use super::super::address::{decode_payment_address, pubkey_hash_at_keypath, ADDRESS_HASH_SIZE};
 
@@ -84,20 +86,21 @@ fn encode_set_header<W: Write>(
     Ok(())
 }
 
-/// CBOR encoding for Cardano transactions.
+/// CBOR encoding for Cardano transactions, up to and including the header of the outputs array,
+/// which has `num_outputs` entries.
 ///
-/// The transaction must be verified/validated before calling this function.
+/// The body is encoded incrementally so the outputs can be streamed: this function, followed by
+/// `encode_output()` for each output, followed by `encode_transaction_body_end()`. The transaction
+/// must be verified/validated before calling these functions.
 ///
 /// References:
 /// - Transaction body encoding spec: https://github.com/input-output-hk/cardano-ledger-specs/blob/d0aa86ded0b973b09b629e5aa62aa1e71364d088/eras/alonzo/test-suite/cddl-files/alonzo.cddl#L50
 /// - Serialization implementation: https://github.com/input-output-hk/cardano-ledger-specs/blob/c6c4be1562e23a3dd48282387c4e48ff918fbab0/eras/shelley-ma/impl/src/Cardano/Ledger/ShelleyMA/TxBody.hs#L208
-pub fn encode_transaction_body<W: Write>(
+pub fn encode_transaction_body_start<W: Write>(
     tx: &pb::CardanoSignTransactionRequest,
-    writer: W,
+    num_outputs: u64,
+    encoder: &mut Encoder<W>,
 ) -> Result<(), Error> {
-    let params = params::get(pb::CardanoNetwork::try_from(tx.network)?);
-    let mut encoder = Encoder::new(writer);
-
     let mut num_map_entries = 3; // inputs, outputs, fee
     if tx.ttl != 0 || tx.allow_zero_ttl {
         num_map_entries += 1;
@@ -115,7 +118,7 @@ pub fn encode_transaction_body<W: Write>(
     encoder.map(num_map_entries)?;
     // Map entry 0 is an array of inputs.
     encoder.u8(0)?;
-    encode_set_header(&mut encoder, tx.inputs.len() as _, tx.tag_cbor_sets)?;
+    encode_set_header(encoder, tx.inputs.len() as _, tx.tag_cbor_sets)?;
     for input in tx.inputs.iter() {
         if input.prev_out_hash.len() != 32 {
             return Err(Error::InvalidInput);
@@ -126,31 +129,53 @@ pub fn encode_transaction_body<W: Write>(
             .u32(input.prev_out_index)?;
     }
     // Map entry 1 is an array of outputs.
-    encoder.u8(1)?.array(tx.outputs.len() as _)?;
-    for output in tx.outputs.iter() {
-        let decoded_address = decode_payment_address(params, &output.encoded_address)?;
-        encoder.array(2)?.bytes(&decoded_address)?;
-        // Second array entry is either the ADA amount, or [ADA amount, assets].
-        //
-        // See
-        // https://github.com/input-output-hk/cardano-ledger/blob/bd9bdb17e493ec1b3c8f329b25a5907d8b3d1cd1/eras/alonzo/test-suite/cddl-files/alonzo.cddl#L362
-        if output.asset_groups.is_empty() {
-            encoder.u64(output.value)?;
-        } else {
-            encoder
-                .array(2)?
-                .u64(output.value)?
-                .map(output.asset_groups.len() as _)?;
-            for asset_group in output.asset_groups.iter() {
-                encoder
-                    .bytes(&asset_group.policy_id)?
-                    .map(asset_group.tokens.len() as _)?;
-                for token in asset_group.tokens.iter() {
-                    encoder.bytes(&token.asset_name)?.u64(token.value)?;
-                }
-            }
-        }
+    encoder.u8(1)?.array(num_outputs)?;
+    Ok(())
+}
+
+/// Encodes an output. If `num_asset_groups` is not zero, the output is encoded up to and
+/// including the header of its assets map, and has to be followed by `num_asset_groups` calls to
+/// `encode_asset_group()`. `output.asset_groups` is ignored.
+pub fn encode_output<W: Write>(
+    params: &params::Params,
+    encoder: &mut Encoder<W>,
+    output: &Output,
+    num_asset_groups: u64,
+) -> Result<(), Error> {
+    let decoded_address = decode_payment_address(params, &output.encoded_address)?;
+    encoder.array(2)?.bytes(&decoded_address)?;
+    // Second array entry is either the ADA amount, or [ADA amount, assets].
+    //
+    // See
+    // https://github.com/input-output-hk/cardano-ledger/blob/bd9bdb17e493ec1b3c8f329b25a5907d8b3d1cd1/eras/alonzo/test-suite/cddl-files/alonzo.cddl#L362
+    if num_asset_groups == 0 {
+        encoder.u64(output.value)?;
+    } else {
+        encoder.array(2)?.u64(output.value)?.map(num_asset_groups)?;
     }
+    Ok(())
+}
+
+/// Encodes one entry of the assets map of an output, see `encode_output()`.
+pub fn encode_asset_group<W: Write>(
+    encoder: &mut Encoder<W>,
+    asset_group: &AssetGroup,
+) -> Result<(), Error> {
+    encoder
+        .bytes(&asset_group.policy_id)?
+        .map(asset_group.tokens.len() as _)?;
+    for token in asset_group.tokens.iter() {
+        encoder.bytes(&token.asset_name)?.u64(token.value)?;
+    }
+    Ok(())
+}
+
+/// Encodes the rest of the transaction body following the outputs.
+pub fn encode_transaction_body_end<W: Write>(
+    tx: &pb::CardanoSignTransactionRequest,
+    encoder: &mut Encoder<W>,
+) -> Result<(), Error> {
+    let params = params::get(pb::CardanoNetwork::try_from(tx.network)?);
     // Map entry 2 is the fee.
     encoder.u8(2)?.u64(tx.fee)?;
     // Optional map entry 3 is ttl.
@@ -160,16 +185,16 @@ pub fn encode_transaction_body<W: Write>(
     // Optional map entry 4 are the certificates:
     if !tx.certificates.is_empty() {
         encoder.u8(4)?;
-        encode_set_header(&mut encoder, tx.certificates.len() as _, tx.tag_cbor_sets)?;
+        encode_set_header(encoder, tx.certificates.len() as _, tx.tag_cbor_sets)?;
         for Certificate { cert } in tx.certificates.iter() {
             match cert.as_ref().ok_or(Error::InvalidInput)? {
                 certificate::Cert::StakeRegistration(pb::Keypath { keypath }) => {
                     encoder.array(2)?.u8(0)?;
-                    encode_stake_credential(&mut encoder, keypath)?;
+                    encode_stake_credential(encoder, keypath)?;
                 }
                 certificate::Cert::StakeDeregistration(pb::Keypath { keypath }) => {
                     encoder.array(2)?.u8(1)?;
-                    encode_stake_credential(&mut encoder, keypath)?;
+                    encode_stake_credential(encoder, keypath)?;
                 }
                 certificate::Cert::StakeDelegation(certificate::StakeDelegation {
                     keypath,
@@ -179,7 +204,7 @@ pub fn encode_transaction_body<W: Write>(
                         return Err(Error::InvalidInput);
                     }
                     encoder.array(3)?.u8(2)?;
-                    encode_stake_credential(&mut encoder, keypath)?;
+                    encode_stake_credential(encoder, keypath)?;
                     encoder.bytes(pool_keyhash)?;
                 }
                 certificate::Cert::VoteDelegation(certificate::VoteDelegation {
@@ -188,7 +213,7 @@ pub fn encode_transaction_body<W: Write>(
                     drep_credhash,
                 }) => {
                     encoder.array(3)?.u8(9)?;
-                    encode_stake_credential(&mut encoder, keypath)?;
+                    encode_stake_credential(encoder, keypath)?;
                     let drep_type =
                         certificate::vote_delegation::CardanoDRepType::try_from(*r#type)?;
                     match drep_type {
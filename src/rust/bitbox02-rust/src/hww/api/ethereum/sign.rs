@@ -458,7 +458,7 @@ mod tests {
             b"\xa9\x05\x9c\xbb\0\0\0\0\0\0\0\0\0\0\0\0abcdefghijklmnopqrst\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x55\0\0\0\xff";
         assert_eq!(
             parse_erc20(&Transaction::Legacy(&pb::EthSignRequest {
-                data: valid_data.to_vec(),
+                data: valid_data.to_vec().into(),
                 ..Default::default()
             })),
             Some((*b"abcdefghijklmnopqrst", 365072220415u64.into()))
@@ -467,7 +467,7 @@ mod tests {
         // ETH value must be 0 when transacting ERC20.
         assert!(parse_erc20(&Transaction::Legacy(&pb::EthSignRequest {
             value: vec![0],
-            data: valid_data.to_vec(),
+            data: valid_data.to_vec().into(),
             ..Default::default()
         }))
         .is_none());
@@ -475,7 +475,7 @@ mod tests {
         // Invalid method (first byte)
         let invalid_data = b"\xa8\x05\x9c\xbb\0\0\0\0\0\0\0\0\0\0\0\0abcdefghijklmnopqrst\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff";
         assert!(parse_erc20(&Transaction::Legacy(&pb::EthSignRequest {
-            data: invalid_data.to_vec(),
+            data: invalid_data.to_vec().into(),
             ..Default::default()
         }))
         .is_none());
@@ -483,7 +483,7 @@ mod tests {
         // Recipient too long (not zero padded)
         let invalid_data = b"\xa9\x05\x9c\xbb\0\0\0\0\0\0\0\0\0\0\0babcdefghijklmnopqrst\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xff";
         assert!(parse_erc20(&Transaction::Legacy(&pb::EthSignRequest {
-            data: invalid_data.to_vec(),
+            data: invalid_data.to_vec().into(),
             ..Default::default()
         }))
         .is_none());
@@ -491,7 +491,7 @@ mod tests {
         // Value can't be zero
         let invalid_data = b"\xa9\x05\x9c\xbb\0\0\0\0\0\0\0\0\0\0\0\0abcdefghijklmnopqrst\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x00";
         assert!(parse_erc20(&Transaction::Legacy(&pb::EthSignRequest {
-            data: invalid_data.to_vec(),
+            data: invalid_data.to_vec().into(),
             ..Default::default()
         }))
         .is_none());
@@ -534,7 +534,7 @@ mod tests {
                 gas_limit: b"\x52\x08".to_vec(),
                 recipient: b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85".to_vec(),
                 value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-                data: b"".to_vec(),
+                data: b"".to_vec().into(),
                 host_nonce_commitment: None,
                 chain_id: 0,
                 address_case: pb::EthAddressCase::Mixed as _,
@@ -556,7 +556,7 @@ mod tests {
                 gas_limit: b"\x52\x08".to_vec(),
                 recipient: b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85".to_vec(),
                 value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-                data: b"".to_vec(),
+                data: b"".to_vec().into(),
                 host_nonce_commitment: None,
                 chain_id: 1,
                 address_case: pb::EthAddressCase::Mixed as _,
@@ -590,7 +590,7 @@ mod tests {
                     .to_vec(),
             // 530564000000000000
             value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-            data: b"".to_vec(),
+            data: b"".to_vec().into(),
             host_nonce_commitment: None,
             chain_id: 0,
             address_case: pb::EthAddressCase::Mixed as _,
@@ -646,7 +646,7 @@ mod tests {
                     .to_vec(),
             // 530564000000000000
             value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-            data: b"".to_vec(),
+            data: b"".to_vec().into(),
             host_nonce_commitment: None,
             chain_id: 1,
             address_case: pb::EthAddressCase::Mixed as _,
@@ -700,7 +700,7 @@ mod tests {
                 b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85"
                     .to_vec(),
             value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-            data: b"".to_vec(),
+            data: b"".to_vec().into(),
             host_nonce_commitment: None,
             chain_id: 11155111,
             address_case: pb::EthAddressCase::Mixed as _,
@@ -753,7 +753,7 @@ mod tests {
                 gas_limit: b"\x52\x08".to_vec(),
                 recipient: b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85".to_vec(),
                 value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-                data: b"foo bar".to_vec(),
+                data: b"foo bar".to_vec().into(),
                 host_nonce_commitment: None,
                 chain_id: 0,
                 address_case: pb::EthAddressCase::Mixed as _,
@@ -819,7 +819,7 @@ mod tests {
                 gas_limit: b"\x52\x08".to_vec(),
                 recipient: b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85".to_vec(),
                 value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-                data: b"foo bar".to_vec(),
+                data: b"foo bar".to_vec().into(),
                 host_nonce_commitment: None,
                 chain_id: 1,
                 address_case: pb::EthAddressCase::Mixed as _,
@@ -907,7 +907,7 @@ mod tests {
                 gas_limit: b"\x01\xd0\x48".to_vec(),
                 recipient: b"\xda\xc1\x7f\x95\x8d\x2e\xe5\x23\xa2\x20\x62\x06\x99\x45\x97\xc1\x3d\x83\x1e\xc7".to_vec(),
                 value: b"".to_vec(),
-                data: b"\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe6\xce\x0a\x09\x2a\x99\x70\x0c\xd4\xcc\xcc\xbb\x1f\xed\xc3\x9c\xf5\x3e\x63\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\x65\xc0\x40".to_vec(),
+                data: b"\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe6\xce\x0a\x09\x2a\x99\x70\x0c\xd4\xcc\xcc\xbb\x1f\xed\xc3\x9c\xf5\x3e\x63\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\x65\xc0\x40".to_vec().into(),
                 host_nonce_commitment: None,
                 chain_id: 1,
                 address_case: pb::EthAddressCase::Mixed as _,
@@ -929,7 +929,7 @@ mod tests {
                 gas_limit: b"\x01\xd0\x48".to_vec(),
                 recipient: b"\xda\xc1\x7f\x95\x8d\x2e\xe5\x23\xa2\x20\x62\x06\x99\x45\x97\xc1\x3d\x83\x1e\xc7".to_vec(),
                 value: b"".to_vec(),
-                data: b"\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe6\xce\x0a\x09\x2a\x99\x70\x0c\xd4\xcc\xcc\xbb\x1f\xed\xc3\x9c\xf5\x3e\x63\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\x65\xc0\x40".to_vec(),
+                data: b"\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe6\xce\x0a\x09\x2a\x99\x70\x0c\xd4\xcc\xcc\xbb\x1f\xed\xc3\x9c\xf5\x3e\x63\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\x65\xc0\x40".to_vec().into(),
                 host_nonce_commitment: None,
                 chain_id: 1,
                 address_case: pb::EthAddressCase::Mixed as _,
@@ -978,7 +978,7 @@ mod tests {
                 gas_limit: b"\x01\x09\x85".to_vec(),
                 recipient: b"\x9c\x23\xd6\x7a\xea\x7b\x95\xd8\x09\x42\xe3\x83\x6b\xcd\xf7\xe7\x08\xa7\x47\xc1".to_vec(),
                 value: b"".to_vec(),
-                data: b"\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x85\x7b\x3d\x96\x9e\xac\xb7\x75\xa9\xf7\x9c\xab\xc6\x2e\xc4\xbb\x1d\x1c\xd6\x0e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x98\xa6\x3c\xbe\xb8\x59\xd0\x27\xb0".to_vec(),
+                data: b"\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x85\x7b\x3d\x96\x9e\xac\xb7\x75\xa9\xf7\x9c\xab\xc6\x2e\xc4\xbb\x1d\x1c\xd6\x0e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x98\xa6\x3c\xbe\xb8\x59\xd0\x27\xb0".to_vec().into(),
                 host_nonce_commitment: None,
                 chain_id: 0,
                 address_case: pb::EthAddressCase::Mixed as _,
@@ -1000,7 +1000,7 @@ mod tests {
                 gas_limit: b"\x01\x09\x85".to_vec(),
                 recipient: b"\x9c\x23\xd6\x7a\xea\x7b\x95\xd8\x09\x42\xe3\x83\x6b\xcd\xf7\xe7\x08\xa7\x47\xc1".to_vec(),
                 value: b"".to_vec(),
-                data: b"\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x85\x7b\x3d\x96\x9e\xac\xb7\x75\xa9\xf7\x9c\xab\xc6\x2e\xc4\xbb\x1d\x1c\xd6\x0e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x98\xa6\x3c\xbe\xb8\x59\xd0\x27\xb0".to_vec(),
+                data: b"\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x85\x7b\x3d\x96\x9e\xac\xb7\x75\xa9\xf7\x9c\xab\xc6\x2e\xc4\xbb\x1d\x1c\xd6\x0e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x98\xa6\x3c\xbe\xb8\x59\xd0\x27\xb0".to_vec().into(),
                 host_nonce_commitment: None,
                 chain_id: 1,
                 address_case: pb::EthAddressCase::Mixed as _,
@@ -1025,7 +1025,7 @@ mod tests {
                 b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85"
                     .to_vec(),
             value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-            data: b"".to_vec(),
+            data: b"".to_vec().into(),
             host_nonce_commitment: None,
             chain_id: 0,
             address_case: pb::EthAddressCase::Mixed as _,
@@ -1083,7 +1083,7 @@ mod tests {
         {
             // data too long
             let mut invalid_request = valid_request.clone();
-            invalid_request.data = vec![0; 6145];
+            invalid_request.data = vec![0; 6145].into();
             assert_eq!(
                 block_on(process(
                     &mut TestingHal::new(),
@@ -1178,7 +1178,7 @@ mod tests {
                 b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85"
                     .to_vec(),
             value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-            data: b"".to_vec(),
+            data: b"".to_vec().into(),
             host_nonce_commitment: None,
             chain_id: 1,
             address_case: pb::EthAddressCase::Mixed as _,
@@ -1224,7 +1224,7 @@ mod tests {
                 gas_limit: b"\x52\x08".to_vec(),
                 recipient: b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85".to_vec(),
                 value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-                data: b"".to_vec(),
+                data: b"".to_vec().into(),
                 host_nonce_commitment: None,
                 chain_id: 12345,
                 address_case: pb::EthAddressCase::Mixed as _,
@@ -1281,7 +1281,7 @@ mod tests {
                 b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85"
                     .to_vec(),
             value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-            data: b"".to_vec(),
+            data: b"".to_vec().into(),
             host_nonce_commitment: None,
             chain_id: 42161,
             address_case: pb::EthAddressCase::Mixed as _,
@@ -1316,7 +1316,7 @@ mod tests {
                 b"\x04\xf2\x64\xcf\x34\x44\x03\x13\xb4\xa0\x19\x2a\x35\x28\x14\xfb\xe9\x27\xb8\x85"
                     .to_vec(),
             value: b"\x07\x5c\xf1\x25\x9e\x9c\x40\x00".to_vec(),
-            data: b"".to_vec(),
+            data: b"".to_vec().into(),
             host_nonce_commitment: None,
             chain_id: 137,
             address_case: pb::EthAddressCase::Mixed as _,
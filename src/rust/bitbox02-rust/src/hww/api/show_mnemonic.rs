@@ -33,7 +33,10 @@ pub async fn process(hal: &mut impl crate::hal::Hal) -> Result<Response, Error>
         unlock::unlock_keystore(hal, "Unlock device", unlock::CanCancel::Yes).await?;
     }
 
-    let mnemonic_sentence = keystore::get_bip39_mnemonic()?;
+    let mnemonic_words = crate::bip39::entropy_to_indices(&keystore::copy_seed()?)?
+        .iter()
+        .map(|&idx| keystore::get_bip39_word(idx))
+        .collect::<Result<Vec<_>, ()>>()?;
 
     hal.ui()
         .confirm(&confirm::Params {
@@ -53,7 +56,7 @@ pub async fn process(hal: &mut impl crate::hal::Hal) -> Result<Response, Error>
         })
         .await?;
 
-    let words: Vec<&str> = mnemonic_sentence.split(' ').collect();
+    let words: Vec<&str> = mnemonic_words.iter().map(|word| word.as_str()).collect();
 
     mnemonic::show_and_confirm_mnemonic(hal, &words).await?;
 
@@ -14,7 +14,7 @@
 
 use alloc::vec::Vec;
 
-use bip32_ed25519::{Xprv, Xpub, ED25519_EXPANDED_SECRET_KEY_SIZE};
+use bip32_ed25519::{Xprv, Xpub, ED25519_EXPANDED_SECRET_KEY_SIZE, HARDENED_OFFSET};
 
 /// Implements the digest traits for Sha512 backing it with the wally_sha512 C function. This is
 /// done to avoid using a second sha512 implementation like `sha2::Sha512`, which bloats the binary
@@ -79,7 +79,10 @@ pub struct SignResult {
 }
 
 pub fn sign(keypath: &[u32], msg: &[u8; 32]) -> Result<SignResult, ()> {
-    let xprv = get_xprv(keypath)?;
+    sign_with_xprv(&get_xprv(keypath)?, msg)
+}
+
+fn sign_with_xprv(xprv: &Xprv<Sha512>, msg: &[u8; 32]) -> Result<SignResult, ()> {
     let secret_key =
         ed25519_dalek::hazmat::ExpandedSecretKey::from_bytes(&xprv.expanded_secret_key());
     let public_key = ed25519_dalek::VerifyingKey::from(&secret_key);
@@ -90,11 +93,57 @@ pub fn sign(keypath: &[u32], msg: &[u8; 32]) -> Result<SignResult, ()> {
     })
 }
 
+/// Caches the xprvs at the hardened prefixes of keypaths, e.g. at the account level
+/// m/1852'/1815'/account' of m/1852'/1815'/account'/role/index. Signing with many keypaths of the
+/// same account then derives only the unhardened suffix instead of the full path from the seed.
+///
+/// The cache holds private keys. It should only be kept for the duration of one request.
+pub struct XprvCache {
+    // First tuple element is the hardened keypath prefix, the second element its xprv.
+    xprvs: Vec<(Vec<u32>, Xprv<Sha512>)>,
+}
+
+impl Default for XprvCache {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl XprvCache {
+    pub fn new() -> Self {
+        XprvCache { xprvs: Vec::new() }
+    }
+
+    fn get_xprv(&mut self, keypath: &[u32]) -> Result<Xprv<Sha512>, ()> {
+        let hardened_len = keypath
+            .iter()
+            .rposition(|&element| element >= HARDENED_OFFSET)
+            .map_or(0, |pos| pos + 1);
+        let (prefix, suffix) = keypath.split_at(hardened_len);
+        let cached_idx = match self
+            .xprvs
+            .iter()
+            .position(|(cached_prefix, _)| cached_prefix == prefix)
+        {
+            Some(idx) => idx,
+            None => {
+                self.xprvs.push((prefix.to_vec(), get_xprv(prefix)?));
+                self.xprvs.len() - 1
+            }
+        };
+        Ok(self.xprvs[cached_idx].1.derive_path(suffix))
+    }
+
+    /// Same as `sign()`, using and filling the cache.
+    pub fn sign(&mut self, keypath: &[u32], msg: &[u8; 32]) -> Result<SignResult, ()> {
+        sign_with_xprv(&self.get_xprv(keypath)?, msg)
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
 
-    use bip32_ed25519::HARDENED_OFFSET;
     use bitbox02::testing::{mock_unlocked, mock_unlocked_using_mnemonic};
     use digest::Digest;
 
@@ -193,4 +242,78 @@ mod tests {
             *b"\x6c\x9b\xc4\x0e\x34\xe2\xa9\xb7\x88\x5e\xec\x72\xc0\x60\xba\x76\x9f\xe3\xa7\x4c\x9b\x14\x4b\xbf\x63\xf4\xd5\x4e\xa6\x66\x04\x31\x34\x25\x0e\xb2\x7d\xd3\x42\x28\x47\x5d\x7c\x6b\x54\x32\xd7\x37\x42\xf4\xb5\xa0\x98\xf4\x65\xba\x10\x1e\x90\xd1\x00\x35\x68\x01"
         );
     }
+
+    #[test]
+    fn test_xprv_cache() {
+        bitbox02::keystore::lock();
+        let mut cache = XprvCache::new();
+        assert!(cache.sign(&[10 + HARDENED_OFFSET, 10], &[0u8; 32]).is_err());
+        assert!(cache.xprvs.is_empty());
+
+        mock_unlocked();
+        let account = [
+            1852 + HARDENED_OFFSET,
+            1815 + HARDENED_OFFSET,
+            HARDENED_OFFSET,
+        ];
+        let keypaths: &[&[u32]] = &[
+            &[
+                1852 + HARDENED_OFFSET,
+                1815 + HARDENED_OFFSET,
+                HARDENED_OFFSET,
+                0,
+                0,
+            ],
+            &[
+                1852 + HARDENED_OFFSET,
+                1815 + HARDENED_OFFSET,
+                HARDENED_OFFSET,
+                0,
+                1,
+            ],
+            &[
+                1852 + HARDENED_OFFSET,
+                1815 + HARDENED_OFFSET,
+                HARDENED_OFFSET,
+                2,
+                0,
+            ],
+            &[
+                1852 + HARDENED_OFFSET,
+                1815 + HARDENED_OFFSET,
+                1 + HARDENED_OFFSET,
+                0,
+                0,
+            ],
+            &[
+                1852 + HARDENED_OFFSET,
+                1815 + HARDENED_OFFSET,
+                HARDENED_OFFSET,
+            ],
+            &[10 + HARDENED_OFFSET, 10],
+            &[10],
+        ];
+        let msg = &[1u8; 32];
+        for keypath in keypaths {
+            let cached = cache.sign(keypath, msg).unwrap();
+            let uncached = sign(keypath, msg).unwrap();
+            assert_eq!(cached.signature, uncached.signature);
+            assert_eq!(cached.public_key, uncached.public_key);
+        }
+        // One entry per hardened prefix.
+        let prefixes: Vec<&[u32]> = cache.xprvs.iter().map(|(kp, _)| kp.as_slice()).collect();
+        assert_eq!(
+            prefixes,
+            vec![
+                &account[..],
+                &[
+                    1852 + HARDENED_OFFSET,
+                    1815 + HARDENED_OFFSET,
+                    1 + HARDENED_OFFSET
+                ][..],
+                &[10 + HARDENED_OFFSET][..],
+                &[][..],
+            ]
+        );
+    }
 }
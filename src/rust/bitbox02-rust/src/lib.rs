@@ -31,11 +31,11 @@ pub mod attestation;
 pub mod backup;
 pub mod bb02_async;
 mod bip32;
+mod bip39;
 pub mod hal;
 pub mod hww;
 pub mod keystore;
 mod version;
-mod waker_fn;
 pub mod workflow;
 #[cfg(any(feature = "app-bitcoin", feature = "app-litecoin"))]
 mod xpubcache;
@@ -590,8 +590,8 @@ pub mod btc_sign_next_response {
 #[allow(clippy::derive_partial_eq_without_eq)]
 #[derive(Clone, PartialEq, ::prost::Message)]
 pub struct BtcSignInputRequest {
-    #[prost(bytes = "vec", tag = "1")]
-    pub prev_out_hash: ::prost::alloc::vec::Vec<u8>,
+    #[prost(bytes = "bytes", tag = "1")]
+    pub prev_out_hash: ::prost::bytes::Bytes,
     #[prost(uint32, tag = "2")]
     pub prev_out_index: u32,
     #[prost(uint64, tag = "3")]
@@ -746,12 +746,12 @@ pub struct BtcPrevTxInitRequest {
 #[allow(clippy::derive_partial_eq_without_eq)]
 #[derive(Clone, PartialEq, ::prost::Message)]
 pub struct BtcPrevTxInputRequest {
-    #[prost(bytes = "vec", tag = "1")]
-    pub prev_out_hash: ::prost::alloc::vec::Vec<u8>,
+    #[prost(bytes = "bytes", tag = "1")]
+    pub prev_out_hash: ::prost::bytes::Bytes,
     #[prost(uint32, tag = "2")]
     pub prev_out_index: u32,
-    #[prost(bytes = "vec", tag = "3")]
-    pub signature_script: ::prost::alloc::vec::Vec<u8>,
+    #[prost(bytes = "bytes", tag = "3")]
+    pub signature_script: ::prost::bytes::Bytes,
     #[prost(uint32, tag = "4")]
     pub sequence: u32,
 }
@@ -760,8 +760,8 @@ pub struct BtcPrevTxInputRequest {
 pub struct BtcPrevTxOutputRequest {
     #[prost(uint64, tag = "1")]
     pub value: u64,
-    #[prost(bytes = "vec", tag = "2")]
-    pub pubkey_script: ::prost::alloc::vec::Vec<u8>,
+    #[prost(bytes = "bytes", tag = "2")]
+    pub pubkey_script: ::prost::bytes::Bytes,
 }
 #[allow(clippy::derive_partial_eq_without_eq)]
 #[derive(Clone, PartialEq, ::prost::Message)]
@@ -820,10 +820,46 @@ pub struct BtcSignMessageResponse {
     #[prost(bytes = "vec", tag = "1")]
     pub signature: ::prost::alloc::vec::Vec<u8>,
 }
+/// Derives a contiguous range of xpubs or single-sig addresses without displaying them, e.g. for
+/// gap limit scanning. Element i is derived at `keypath` + \[start_index + i\].
+#[allow(clippy::derive_partial_eq_without_eq)]
+#[derive(Clone, PartialEq, ::prost::Message)]
+pub struct BtcPubRangeRequest {
+    #[prost(enumeration = "BtcCoin", tag = "1")]
+    pub coin: i32,
+    /// Keypath of the parent node, e.g. m/84'/0'/0'/0 for the receive addresses of an account.
+    #[prost(uint32, repeated, tag = "2")]
+    pub keypath: ::prost::alloc::vec::Vec<u32>,
+    #[prost(uint32, tag = "5")]
+    pub start_index: u32,
+    #[prost(uint32, tag = "6")]
+    pub count: u32,
+    #[prost(oneof = "btc_pub_range_request::Output", tags = "3, 4")]
+    pub output: ::core::option::Option<btc_pub_range_request::Output>,
+}
+/// Nested message and enum types in `BTCPubRangeRequest`.
+pub mod btc_pub_range_request {
+    #[allow(clippy::derive_partial_eq_without_eq)]
+    #[derive(Clone, PartialEq, ::prost::Oneof)]
+    pub enum Output {
+        #[prost(enumeration = "super::btc_pub_request::XPubType", tag = "3")]
+        XpubType(i32),
+        #[prost(enumeration = "super::btc_script_config::SimpleType", tag = "4")]
+        SimpleType(i32),
+    }
+}
+#[allow(clippy::derive_partial_eq_without_eq)]
+#[derive(Clone, PartialEq, ::prost::Message)]
+pub struct BtcPubRangeResponse {
+    /// The xpubs/addresses starting at `start_index`. If not all `count` elements fit into one
+    /// response, fewer are returned; request the rest starting at `start_index + len(pubs)`.
+    #[prost(string, repeated, tag = "1")]
+    pub pubs: ::prost::alloc::vec::Vec<::prost::alloc::string::String>,
+}
 #[allow(clippy::derive_partial_eq_without_eq)]
 #[derive(Clone, PartialEq, ::prost::Message)]
 pub struct BtcRequest {
-    #[prost(oneof = "btc_request::Request", tags = "1, 2, 3, 4, 5, 6, 7, 8")]
+    #[prost(oneof = "btc_request::Request", tags = "1, 2, 3, 4, 5, 6, 7, 8, 9")]
     pub request: ::core::option::Option<btc_request::Request>,
 }
 /// Nested message and enum types in `BTCRequest`.
@@ -847,12 +883,14 @@ pub mod btc_request {
         AntikleptoSignature(super::AntiKleptoSignatureRequest),
         #[prost(message, tag = "8")]
         PaymentRequest(super::BtcPaymentRequestRequest),
+        #[prost(message, tag = "9")]
+        PubRange(super::BtcPubRangeRequest),
     }
 }
 #[allow(clippy::derive_partial_eq_without_eq)]
 #[derive(Clone, PartialEq, ::prost::Message)]
 pub struct BtcResponse {
-    #[prost(oneof = "btc_response::Response", tags = "1, 2, 3, 4, 5")]
+    #[prost(oneof = "btc_response::Response", tags = "1, 2, 3, 4, 5, 6")]
     pub response: ::core::option::Option<btc_response::Response>,
 }
 /// Nested message and enum types in `BTCResponse`.
@@ -870,6 +908,8 @@ pub mod btc_response {
         SignMessage(super::BtcSignMessageResponse),
         #[prost(message, tag = "5")]
         AntikleptoSignerCommitment(super::AntiKleptoSignerCommitment),
+        #[prost(message, tag = "6")]
+        PubRange(super::BtcPubRangeResponse),
     }
 }
 #[derive(Clone, Copy, Debug, PartialEq, Eq, Hash, PartialOrd, Ord, ::prost::Enumeration)]
@@ -1002,7 +1042,8 @@ pub struct CardanoAddressRequest {
 }
 /// Max allowed transaction size is 16384 bytes according to
 /// <https://github.com/cardano-foundation/CIPs/blob/master/CIP-0009/CIP-0009.md.> Unlike with BTC, we
-/// can fit the whole request in RAM and don't need to stream.
+/// can usually fit the whole request in RAM. Transactions with many outputs or assets can be
+/// streamed by setting `num_outputs`, see `CardanoSignTransactionNextResponse`.
 ///
 /// See also: <https://github.com/input-output-hk/cardano-ledger-specs/blob/d0aa86ded0b973b09b629e5aa62aa1e71364d088/eras/alonzo/test-suite/cddl-files/alonzo.cddl#L50>
 #[allow(clippy::derive_partial_eq_without_eq)]
@@ -1035,6 +1076,9 @@ pub struct CardanoSignTransactionRequest {
     /// See <https://github.com/IntersectMBO/cardano-ledger/blob/6e2d37cc0f47bd02e89b4ce9f78b59c35c958e96/eras/conway/impl/cddl-files/extra.cddl#L5>
     #[prost(bool, tag = "10")]
     pub tag_cbor_sets: bool,
+    /// If non-zero, `outputs` must be empty, and the device requests this many outputs in batches.
+    #[prost(uint32, tag = "11")]
+    pub num_outputs: u32,
 }
 /// Nested message and enum types in `CardanoSignTransactionRequest`.
 pub mod cardano_sign_transaction_request {
@@ -1081,6 +1125,10 @@ pub mod cardano_sign_transaction_request {
         pub script_config: ::core::option::Option<super::CardanoScriptConfig>,
         #[prost(message, repeated, tag = "4")]
         pub asset_groups: ::prost::alloc::vec::Vec<AssetGroup>,
+        /// Only if the outputs are streamed: if non-zero, `asset_groups` must be empty, and the device
+        /// requests this many asset groups in batches.
+        #[prost(uint32, tag = "5")]
+        pub num_asset_groups: u32,
     }
     /// See <https://github.com/IntersectMBO/cardano-ledger/blob/cardano-ledger-conway-1.12.0.0/eras/conway/impl/cddl-files/conway.cddl#L273>
     #[allow(clippy::derive_partial_eq_without_eq)]
@@ -1177,6 +1225,76 @@ pub mod cardano_sign_transaction_request {
         pub value: u64,
     }
 }
+/// Sent by the device instead of the final response while the outputs of a transaction are
+/// streamed. The host responds with a batch of one or more items starting at the requested index:
+/// `CardanoSignTransactionOutputsRequest` for OUTPUTS, `CardanoSignTransactionAssetGroupsRequest`
+/// for ASSET_GROUPS.
+#[allow(clippy::derive_partial_eq_without_eq)]
+#[derive(Clone, PartialEq, ::prost::Message)]
+pub struct CardanoSignTransactionNextResponse {
+    #[prost(enumeration = "cardano_sign_transaction_next_response::Type", tag = "1")]
+    pub r#type: i32,
+    /// Index of the first requested output, or of the output whose asset groups are requested.
+    #[prost(uint32, tag = "2")]
+    pub output_index: u32,
+    /// Index of the first requested asset group of the output. Only for ASSET_GROUPS.
+    #[prost(uint32, tag = "3")]
+    pub asset_group_index: u32,
+}
+/// Nested message and enum types in `CardanoSignTransactionNextResponse`.
+pub mod cardano_sign_transaction_next_response {
+    #[derive(
+        Clone,
+        Copy,
+        Debug,
+        PartialEq,
+        Eq,
+        Hash,
+        PartialOrd,
+        Ord,
+        ::prost::Enumeration
+    )]
+    #[repr(i32)]
+    pub enum Type {
+        Outputs = 0,
+        AssetGroups = 1,
+    }
+    impl Type {
+        /// String value of the enum field names used in the ProtoBuf definition.
+        ///
+        /// The values are not transformed in any way and thus are considered stable
+        /// (if the ProtoBuf definition does not change) and safe for programmatic use.
+        pub fn as_str_name(&self) -> &'static str {
+            match self {
+                Type::Outputs => "OUTPUTS",
+                Type::AssetGroups => "ASSET_GROUPS",
+            }
+        }
+        /// Creates an enum from field names used in the ProtoBuf definition.
+        pub fn from_str_name(value: &str) -> ::core::option::Option<Self> {
+            match value {
+                "OUTPUTS" => Some(Self::Outputs),
+                "ASSET_GROUPS" => Some(Self::AssetGroups),
+                _ => None,
+            }
+        }
+    }
+}
+#[allow(clippy::derive_partial_eq_without_eq)]
+#[derive(Clone, PartialEq, ::prost::Message)]
+pub struct CardanoSignTransactionOutputsRequest {
+    #[prost(message, repeated, tag = "1")]
+    pub outputs: ::prost::alloc::vec::Vec<cardano_sign_transaction_request::Output>,
+}
+/// Streamed asset groups must be sorted by strictly increasing policy id.
+#[allow(clippy::derive_partial_eq_without_eq)]
+#[derive(Clone, PartialEq, ::prost::Message)]
+pub struct CardanoSignTransactionAssetGroupsRequest {
+    #[prost(message, repeated, tag = "1")]
+    pub asset_groups: ::prost::alloc::vec::Vec<
+        cardano_sign_transaction_request::AssetGroup,
+    >,
+}
 #[allow(clippy::derive_partial_eq_without_eq)]
 #[derive(Clone, PartialEq, ::prost::Message)]
 pub struct CardanoSignTransactionResponse {
@@ -1199,7 +1317,7 @@ pub mod cardano_sign_transaction_response {
 #[allow(clippy::derive_partial_eq_without_eq)]
 #[derive(Clone, PartialEq, ::prost::Message)]
 pub struct CardanoRequest {
-    #[prost(oneof = "cardano_request::Request", tags = "1, 2, 3")]
+    #[prost(oneof = "cardano_request::Request", tags = "1, 2, 3, 4, 5")]
     pub request: ::core::option::Option<cardano_request::Request>,
 }
 /// Nested message and enum types in `CardanoRequest`.
@@ -1213,12 +1331,16 @@ pub mod cardano_request {
         Address(super::CardanoAddressRequest),
         #[prost(message, tag = "3")]
         SignTransaction(super::CardanoSignTransactionRequest),
+        #[prost(message, tag = "4")]
+        Outputs(super::CardanoSignTransactionOutputsRequest),
+        #[prost(message, tag = "5")]
+        AssetGroups(super::CardanoSignTransactionAssetGroupsRequest),
     }
 }
 #[allow(clippy::derive_partial_eq_without_eq)]
 #[derive(Clone, PartialEq, ::prost::Message)]
 pub struct CardanoResponse {
-    #[prost(oneof = "cardano_response::Response", tags = "1, 2, 3")]
+    #[prost(oneof = "cardano_response::Response", tags = "1, 2, 3, 4")]
     pub response: ::core::option::Option<cardano_response::Response>,
 }
 /// Nested message and enum types in `CardanoResponse`.
@@ -1232,6 +1354,8 @@ pub mod cardano_response {
         Pub(super::PubResponse),
         #[prost(message, tag = "3")]
         SignTransaction(super::CardanoSignTransactionResponse),
+        #[prost(message, tag = "4")]
+        SignTransactionNext(super::CardanoSignTransactionNextResponse),
     }
 }
 #[derive(Clone, Copy, Debug, PartialEq, Eq, Hash, PartialOrd, Ord, ::prost::Enumeration)]
@@ -1341,8 +1465,8 @@ pub struct EthSignRequest {
     /// smallest big endian serialization, max. 32 bytes
     #[prost(bytes = "vec", tag = "7")]
     pub value: ::prost::alloc::vec::Vec<u8>,
-    #[prost(bytes = "vec", tag = "8")]
-    pub data: ::prost::alloc::vec::Vec<u8>,
+    #[prost(bytes = "bytes", tag = "8")]
+    pub data: ::prost::bytes::Bytes,
     #[prost(message, optional, tag = "9")]
     pub host_nonce_commitment: ::core::option::Option<AntiKleptoHostNonceCommitment>,
     /// If non-zero, `coin` is ignored and `chain_id` is used to identify the network.
@@ -1377,8 +1501,8 @@ pub struct EthSignEip1559Request {
     /// smallest big endian serialization, max. 32 bytes
     #[prost(bytes = "vec", tag = "8")]
     pub value: ::prost::alloc::vec::Vec<u8>,
-    #[prost(bytes = "vec", tag = "9")]
-    pub data: ::prost::alloc::vec::Vec<u8>,
+    #[prost(bytes = "bytes", tag = "9")]
+    pub data: ::prost::bytes::Bytes,
     #[prost(message, optional, tag = "10")]
     pub host_nonce_commitment: ::core::option::Option<AntiKleptoHostNonceCommitment>,
     #[prost(enumeration = "EthAddressCase", tag = "11")]
@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use crate::bb02_async::option_no_screensaver;
+use crate::bb02_async::{option_no_screensaver, resolve};
 use core::cell::RefCell;
 
 use super::confirm;
@@ -26,12 +26,12 @@ pub type ResultCell<R> = RefCell<Option<Result<R, Error>>>;
 
 /// Resolves the `with_cancel` future as cancelled.
 pub fn cancel<R>(result_cell: &ResultCell<R>) {
-    *result_cell.borrow_mut() = Some(Err(Error::Cancelled));
+    resolve(result_cell, Err(Error::Cancelled));
 }
 
 /// Resolves the `with_cancel` future with the given result.
 pub fn set_result<R>(result_cell: &ResultCell<R>, result: R) {
-    *result_cell.borrow_mut() = Some(Ok(result));
+    resolve(result_cell, Ok(result));
 }
 
 /// Blocks on showing/running a component until `cancel` or `result` is
@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use crate::bb02_async::option_no_screensaver;
+use crate::bb02_async::{option_no_screensaver, resolve};
 
 pub use bitbox02::ui::{ConfirmParams as Params, Font};
 
@@ -24,11 +24,7 @@ pub async fn confirm(params: &Params<'_>) -> Result<(), UserAbort> {
 
     // The component will set the result when the user accepted/rejected.
     let mut component = bitbox02::ui::confirm_create(params, |accepted| {
-        *result.borrow_mut() = if accepted {
-            Some(Ok(()))
-        } else {
-            Some(Err(UserAbort))
-        };
+        resolve(&result, if accepted { Ok(()) } else { Err(UserAbort) });
     });
     component.screen_stack_push();
     option_no_screensaver(&result).await
@@ -14,7 +14,7 @@
 
 pub use super::cancel::Error as CancelError;
 
-use crate::bb02_async::option_no_screensaver;
+use crate::bb02_async::{option_no_screensaver, resolve};
 
 use alloc::boxed::Box;
 use core::cell::RefCell;
@@ -26,11 +26,11 @@ pub async fn pick(words: &[&str], title: Option<&str>) -> Result<u8, CancelError
         words,
         title,
         select_word_cb: Some(Box::new(|choice_idx| {
-            *result.borrow_mut() = Some(Ok(choice_idx));
+            resolve(&result, Ok(choice_idx));
         })),
         continue_on_last_cb: None,
         cancel_cb: Some(Box::new(|| {
-            *result.borrow_mut() = Some(Err(CancelError::Cancelled));
+            resolve(&result, Err(CancelError::Cancelled));
         })),
     });
     component.screen_stack_push();
@@ -25,8 +25,6 @@ use alloc::string::String;
 use alloc::vec::Vec;
 use core::cell::RefCell;
 
-use sha2::{Digest, Sha256};
-
 const NUM_RANDOM_WORDS: u8 = 5;
 
 fn as_str_vec(v: &[zeroize::Zeroizing<String>]) -> Vec<&str> {
@@ -145,65 +143,11 @@ pub async fn show_and_confirm_mnemonic(
     Ok(())
 }
 
-/// Given 11/17/23 initial words, this function returns a list of candidate words for the last word,
-/// such that the resulting bip39 phrase has a valid checksum. There are always exactly 8 such words
-/// for 24 word mnemonics, 32 words for 18 word mnemonics and 128 words for 12 word mnemonics.
-/// `entered_words` must contain 11/17/23 words from the BIP39 wordlist.
-/// The result is the list of indices of the words in the BIP39 wordlist.
-fn lastword_choices(entered_words: &[&str]) -> Vec<u16> {
-    let (seed_len_bits, checksum_len_bits, bitmask_seed) = match entered_words.len() {
-        11 => (128, 4, 0b10000000),
-        17 => (192, 6, 0b11100000),
-        23 => (256, 8, 0b11111000),
-        _ => panic!("invalid number of entered words"),
-    };
-    let num_candidates = 1 << (seed_len_bits % 11);
-
-    // A seedphrase for 12/18/24 words encodes 128/192/256 bits. The last 4/6/8 bits is the checksum
-    // (hash over the first 32 bytes). The last word, 11 bits, is the last 7/5/3 bits of the seed
-    // plus 4/6/8 bits of the checksum. We first need the first 11/17/23 words converted to bytes so
-    // we can enumerate the 8/32/128 choices for the last word. libwally only lets us convert a
-    // seedphrase if the checksum matches. Instead of rolling our own decoding function, we quickly
-    // find one valid word by brute-force. We need to check at most 16/64/256 words for that, as
-    // there is exactly one valid word for each 256 words block.
-    let mut seed: zeroize::Zeroizing<Vec<u8>> = {
-        let mut i = 0;
-        loop {
-            let mnemonic = zeroize::Zeroizing::new(format!(
-                "{} {}",
-                entered_words.join(" "),
-                bitbox02::keystore::get_bip39_word(i).unwrap().as_str(),
-            ));
-            if let Ok(seed) = bitbox02::keystore::bip39_mnemonic_to_seed(&mnemonic) {
-                break seed;
-            }
-            i += 1;
-            if i >= 2048 / num_candidates {
-                // There must be a valid word in the first 16/64/256 bip39 words. Something went
-                // wrong.
-                panic!("Could not find a valid word");
-            }
-        }
-    };
-    let seed_len = seed.len();
-    // Generate all words matching the bip39 checksum.
-    (0..num_candidates)
-        .map(|i: u16| {
-            // Set last 7/5/3 bits of the seed to `i`.
-            seed[seed_len - 1] &= bitmask_seed;
-            seed[seed_len - 1] |= i as u8;
-            // Compute checksum.
-            let hash = Sha256::digest(&seed);
-            // Last word is 11 bits: <last 7/5/3 bits of the seed || 4/6/8 bits checksum>.
-            let word_idx: u16 =
-                (i << checksum_len_bits) | (hash[0] >> (8 - checksum_len_bits)) as u16;
-            word_idx
-        })
-        .collect()
-}
-
-fn lastword_choices_strings(entered_words: &[&str]) -> Vec<zeroize::Zeroizing<String>> {
-    lastword_choices(entered_words)
+/// Returns the candidates for the last word of a mnemonic, see `bip39::lastword_choices()`.
+/// `entered_indices` must contain the BIP39 wordlist indices of 11/17/23 words.
+fn lastword_choices_strings(entered_indices: &[u16]) -> Vec<zeroize::Zeroizing<String>> {
+    crate::bip39::lastword_choices(entered_indices)
+        .unwrap()
         .into_iter()
         .map(|word_idx| bitbox02::keystore::get_bip39_word(word_idx).unwrap())
         .collect()
@@ -216,9 +160,9 @@ fn lastword_choices_strings(entered_words: &[&str]) -> Vec<zeroize::Zeroizing<St
 async fn get_24th_word(
     hal: &mut impl crate::hal::Hal,
     title: &str,
-    entered_words: &[&str],
+    entered_indices: &[u16],
 ) -> Result<Option<zeroize::Zeroizing<String>>, CancelError> {
-    let mut choices = lastword_choices_strings(entered_words);
+    let mut choices = lastword_choices_strings(entered_indices);
     // Add one more menu entry.
     let none_of_them_idx = {
         choices.push(zeroize::Zeroizing::new("None of them".into()));
@@ -265,12 +209,12 @@ async fn get_24th_word(
 async fn get_12th_18th_word(
     hal: &mut impl crate::hal::Hal,
     title: &str,
-    entered_words: &[&str],
+    entered_indices: &[u16],
 ) -> Result<zeroize::Zeroizing<String>, CancelError> {
     // With 12/18 words there are 128/32 candidates, so we limit the keyboard to allow entering only
     // these.
+    let choices = crate::bip39::lastword_choices(entered_indices).unwrap();
     loop {
-        let choices = lastword_choices(entered_words);
         let candidates = bitbox02::keystore::get_bip39_wordlist(Some(&choices));
         let word = hal
             .ui()
@@ -301,10 +245,11 @@ async fn get_12th_18th_word(
     }
 }
 
-/// Retrieve a BIP39 mnemonic sentence of 12, 18 or 24 words from the user.
+/// Retrieve a BIP39 mnemonic sentence of 12, 18 or 24 words from the user. The result are the
+/// indices of the words in the BIP39 wordlist, see `bip39::indices_to_entropy()`.
 pub async fn get(
     hal: &mut impl crate::hal::Hal,
-) -> Result<zeroize::Zeroizing<String>, CancelError> {
+) -> Result<zeroize::Zeroizing<Vec<u16>>, CancelError> {
     let num_words: usize = match hal
         .ui()
         .trinary_choice("How many words?", "12", "18", "24")
@@ -324,6 +269,7 @@ pub async fn get(
 
     let mut word_idx: usize = 0;
     let mut entered_words = vec![zeroize::Zeroizing::new(String::new()); num_words];
+    let mut entered_indices = zeroize::Zeroizing::new(vec![0u16; num_words]);
     while word_idx < num_words {
         let title = match word_idx + 1 {
             n @ 1 | n @ 21 => format!("{}st word", n),
@@ -337,37 +283,36 @@ pub async fn get(
         // goes forward again.
         let preset = entered_words[word_idx].as_str();
 
-        let user_entry: Result<zeroize::Zeroizing<String>, CancelError> = if word_idx
-            == num_words - 1
-        {
-            // For the last word, we can restrict to a subset of bip39 words that fulfil the
-            // checksum requirement. This special case exists so that users can generate a seed
-            // using only the device and no external software, allowing seed generation via dice
-            // throws, for example.
-            if num_words == 24 {
-                // With 24 words there are only 8 valid candidates. We presnet them as a menu.
-                match get_24th_word(hal, &title, &as_str_vec(&entered_words[..word_idx])).await {
-                    Ok(None) => return Err(CancelError::Cancelled),
-                    Ok(Some(r)) => Ok(r),
-                    Err(e) => Err(e),
+        let user_entry: Result<zeroize::Zeroizing<String>, CancelError> =
+            if word_idx == num_words - 1 {
+                // For the last word, we can restrict to a subset of bip39 words that fulfil the
+                // checksum requirement. This special case exists so that users can generate a seed
+                // using only the device and no external software, allowing seed generation via dice
+                // throws, for example.
+                if num_words == 24 {
+                    // With 24 words there are only 8 valid candidates. We presnet them as a menu.
+                    match get_24th_word(hal, &title, &entered_indices[..word_idx]).await {
+                        Ok(None) => return Err(CancelError::Cancelled),
+                        Ok(Some(r)) => Ok(r),
+                        Err(e) => Err(e),
+                    }
+                } else {
+                    get_12th_18th_word(hal, &title, &entered_indices[..word_idx]).await
                 }
             } else {
-                get_12th_18th_word(hal, &title, &as_str_vec(&entered_words[..word_idx])).await
-            }
-        } else {
-            hal.ui()
-                .enter_string(
-                    &trinary_input_string::Params {
-                        title: &title,
-                        wordlist: Some(&bip39_wordlist),
-                        ..Default::default()
-                    },
-                    trinary_input_string::CanCancel::Yes,
-                    preset,
-                )
-                .await
-                .into()
-        };
+                hal.ui()
+                    .enter_string(
+                        &trinary_input_string::Params {
+                            title: &title,
+                            wordlist: Some(&bip39_wordlist),
+                            ..Default::default()
+                        },
+                        trinary_input_string::CanCancel::Yes,
+                        preset,
+                    )
+                    .await
+                    .into()
+            };
 
         match user_entry {
             Err(CancelError::Cancelled) => {
@@ -417,14 +362,14 @@ pub async fn get(
                 }
             }
             Ok(word) => {
+                // All choices are BIP39 words.
+                entered_indices[word_idx] = bip39_wordlist.position(&word).unwrap() as u16;
                 entered_words[word_idx] = word;
                 word_idx += 1;
             }
         }
     }
-    Ok(zeroize::Zeroizing::new(
-        as_str_vec(&entered_words[..num_words]).join(" "),
-    ))
+    Ok(entered_indices)
 }
 
 #[cfg(test)]
@@ -434,6 +379,14 @@ mod tests {
     use alloc::boxed::Box;
     use bitbox02::testing::{mock, Data};
 
+    fn indices(words: &[&str]) -> Vec<u16> {
+        let wordlist = bitbox02::keystore::get_bip39_wordlist(None);
+        words
+            .iter()
+            .map(|word| wordlist.position(word).unwrap() as u16)
+            .collect()
+    }
+
     fn bruteforce_lastword(mnemonic: &[&str]) -> Vec<zeroize::Zeroizing<String>> {
         let mut result = Vec::new();
         for i in 0..bitbox02::keystore::BIP39_WORDLIST_LEN {
@@ -457,13 +410,13 @@ mod tests {
         );
 
         assert_eq!(
-            &lastword_choices_strings(&["violin"; 23]),
+            &lastword_choices_strings(&indices(&["violin"; 23])),
             &bruteforce_lastword(&["violin"; 23]),
         );
 
         let mnemonic = "side stuff card razor rescue enhance risk exchange ozone render large describe gas juice offer permit vendor custom forget lecture divide junior narrow".split(' ').collect::<Vec<&str>>();
         assert_eq!(
-            &lastword_choices_strings(&mnemonic),
+            &lastword_choices_strings(&indices(&mnemonic)),
             &bruteforce_lastword(&mnemonic)
         );
 
@@ -480,13 +433,13 @@ mod tests {
         );
 
         assert_eq!(
-            &lastword_choices_strings(&["violin"; 17]),
+            &lastword_choices_strings(&indices(&["violin"; 17])),
             &bruteforce_lastword(&["violin"; 17]),
         );
 
         let mnemonic = "alpha write diary chicken cable spoil dirt hair bike fiction system bright mimic garage giggle involve leisure".split(' ').collect::<Vec<&str>>();
         assert_eq!(
-            &lastword_choices_strings(&mnemonic),
+            &lastword_choices_strings(&indices(&mnemonic)),
             &bruteforce_lastword(&mnemonic)
         );
 
@@ -514,7 +467,7 @@ mod tests {
         );
 
         assert_eq!(
-            &lastword_choices_strings(&["violin"; 11]),
+            &lastword_choices_strings(&indices(&["violin"; 11])),
             &bruteforce_lastword(&["violin"; 11]),
         );
 
@@ -522,7 +475,7 @@ mod tests {
             .split(' ')
             .collect::<Vec<&str>>();
         assert_eq!(
-            &lastword_choices_strings(&mnemonic),
+            &lastword_choices_strings(&indices(&mnemonic)),
             &bruteforce_lastword(&mnemonic)
         );
     }
@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use crate::bb02_async::option_no_screensaver;
+use crate::bb02_async::{option_no_screensaver, resolve};
 use core::cell::RefCell;
 
 pub struct UserAbort;
@@ -20,11 +20,7 @@ pub struct UserAbort;
 pub async fn sdcard() -> Result<(), UserAbort> {
     let result = RefCell::new(None as Option<Result<(), UserAbort>>);
     let mut component = bitbox02::ui::sdcard_create(|sd_done| {
-        *result.borrow_mut() = if sd_done {
-            Some(Ok(()))
-        } else {
-            Some(Err(UserAbort))
-        };
+        resolve(&result, if sd_done { Ok(()) } else { Err(UserAbort) });
     });
     component.screen_stack_push();
     option_no_screensaver(&result).await
@@ -12,13 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use crate::bb02_async::option_no_screensaver;
+use crate::bb02_async::{option_no_screensaver, resolve};
 use core::cell::RefCell;
 
 pub async fn status(title: &str, status_success: bool) {
     let result = RefCell::new(None);
     let mut component = bitbox02::ui::status_create(title, status_success, || {
-        *result.borrow_mut() = Some(());
+        resolve(&result, ());
     });
     component.screen_stack_push();
     option_no_screensaver(&result).await
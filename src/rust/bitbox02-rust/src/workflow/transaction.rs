@@ -14,7 +14,7 @@
 
 use crate::hal::Ui;
 
-use crate::bb02_async::option_no_screensaver;
+use crate::bb02_async::{option_no_screensaver, resolve};
 use core::cell::RefCell;
 
 use alloc::boxed::Box;
@@ -29,7 +29,7 @@ pub async fn verify_recipient(recipient: &str, amount: &str) -> Result<(), UserA
         amount,
         recipient,
         Box::new(|ok| {
-            *result.borrow_mut() = Some(if ok { Ok(()) } else { Err(UserAbort) });
+            resolve(&result, if ok { Ok(()) } else { Err(UserAbort) });
         }),
     );
     component.screen_stack_push();
@@ -49,7 +49,7 @@ pub async fn verify_total_fee(total: &str, fee: &str, longtouch: bool) -> Result
         fee,
         longtouch,
         Box::new(|ok| {
-            *result.borrow_mut() = Some(if ok { Ok(()) } else { Err(UserAbort) });
+            resolve(&result, if ok { Ok(()) } else { Err(UserAbort) });
         }),
     );
     component.screen_stack_push();
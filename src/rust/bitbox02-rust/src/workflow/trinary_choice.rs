@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-use crate::bb02_async::option_no_screensaver;
+use crate::bb02_async::{option_no_screensaver, resolve};
 use core::cell::RefCell;
 
 use alloc::boxed::Box;
@@ -34,7 +34,7 @@ pub async fn choose(
         label_middle,
         label_right,
         Box::new(|choice| {
-            *result.borrow_mut() = Some(choice);
+            resolve(&result, choice);
         }),
     );
     component.screen_stack_push();
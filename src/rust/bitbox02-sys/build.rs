@@ -42,6 +42,7 @@ const ALLOWLIST_TYPES: &[&str] = &[
     "buffer_t",
     "component_t",
     "confirm_params_t",
+    "sha256_hw_state_t",
     "trinary_input_string_params_t",
 ];
 
@@ -130,6 +131,9 @@ const ALLOWLIST_FNS: &[&str] = &[
     "securechip_model",
     "securechip_monotonic_increments_remaining",
     "securechip_u2f_counter_set",
+    "sha256_hw_finish",
+    "sha256_hw_init",
+    "sha256_hw_update",
     "smarteeprom_bb02_config",
     "status_create",
     "trinary_choice_create",
@@ -58,6 +58,7 @@
 
 #if !defined(TESTING)
 #include <hal_delay.h>
+#include <sha256_hw.h>
 #else
 void delay_us(const uint16_t us);
 void delay_ms(const uint16_t ms);
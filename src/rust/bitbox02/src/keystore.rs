@@ -167,6 +167,18 @@ impl Bip39Wordlist {
     pub fn len(&self) -> usize {
         self.0.len()
     }
+
+    /// Returns the position of `word` in the list. The list is sorted, as the BIP39 English
+    /// wordlist is sorted and subsets are created in index order.
+    pub fn position(&self, word: &str) -> Option<usize> {
+        self.0
+            .binary_search_by(|&ptr| {
+                unsafe { core::ffi::CStr::from_ptr(ptr as _) }
+                    .to_bytes()
+                    .cmp(word.as_bytes())
+            })
+            .ok()
+    }
 }
 
 impl Drop for Bip39Wordlist {
@@ -482,6 +494,21 @@ mod tests {
         assert_eq!(get_bip39_word(563).unwrap().as_ref() as &str, "edit");
     }
 
+    #[test]
+    fn test_bip39_wordlist_position() {
+        let wordlist = get_bip39_wordlist(None);
+        assert_eq!(wordlist.len(), 2048);
+        assert_eq!(wordlist.position("abandon"), Some(0));
+        assert_eq!(wordlist.position("edit"), Some(563));
+        assert_eq!(wordlist.position("zoo"), Some(2047));
+        assert_eq!(wordlist.position("edi"), None);
+        assert_eq!(wordlist.position(""), None);
+
+        let wordlist = get_bip39_wordlist(Some(&[1, 563, 2000]));
+        assert_eq!(wordlist.position("edit"), Some(1));
+        assert_eq!(wordlist.position("abandon"), None);
+    }
+
     #[test]
     fn test_get_ed25519_seed() {
         // No seed on a locked keystore.
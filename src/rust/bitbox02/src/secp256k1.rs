@@ -13,8 +13,35 @@
 // limitations under the License.
 
 use bitcoin::secp256k1::ffi::CPtr;
+use bitcoin::secp256k1::{All, Secp256k1};
 
 use alloc::vec::Vec;
+use core::cell::OnceCell;
+
+struct SafeContext(OnceCell<Secp256k1<All>>);
+
+// Safety: must not be accessed concurrently.
+unsafe impl Sync for SafeContext {}
+
+static CONTEXT: SafeContext = SafeContext(OnceCell::new());
+
+/// Returns the secp256k1 context shared by all Rust code. It is randomized with the MCU RNG as a
+/// side-channel countermeasure, so callers do not pay for context creation and randomization
+/// themselves.
+///
+/// The firmware creates it at startup (`rust_secp256k1_init()`). Otherwise it is created on first
+/// use, with its memory taken from the heap even if that happens while an arena scope is active.
+pub fn context() -> &'static Secp256k1<All> {
+    CONTEXT.0.get_or_init(|| {
+        util::arena::permanent(|| {
+            let mut context = Secp256k1::new();
+            let mut seed = zeroize::Zeroizing::new([0u8; 32]);
+            crate::random::mcu_32_bytes(&mut seed);
+            context.seeded_randomize(&seed);
+            context
+        })
+    })
+}
 
 pub fn ecdsa_anti_exfil_host_commit(rand32: &[u8]) -> Result<Vec<u8>, ()> {
     let mut out = [0u8; 32];
@@ -86,6 +113,17 @@ mod tests {
     use super::*;
     use bitcoin::secp256k1::{PublicKey, Secp256k1, SecretKey};
 
+    #[test]
+    fn test_context() {
+        // Shared, not recreated.
+        assert!(core::ptr::eq(context(), context()));
+        let seckey = SecretKey::from_slice(&[1; 32]).unwrap();
+        assert_eq!(
+            seckey.public_key(context()),
+            seckey.public_key(&Secp256k1::new())
+        );
+    }
+
     #[test]
     fn test_dleq() {
         let secp = Secp256k1::new();
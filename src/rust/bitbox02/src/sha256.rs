@@ -0,0 +1,68 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//! SHA-256 computed by the MCU's hash engine (ICM) on the device, and by the `sha2` crate
+//! everywhere else (unit tests, simulator).
+//!
+//! `Sha256` implements the same traits as `sha2::Sha256` (`sha2::Digest` is implemented through
+//! them), so it can be used as a drop-in replacement. The engine keeps no state between calls, so
+//! any number of hashers can be in progress at the same time. The engine wrapper is tested in
+//! `test/unit-test/test_sha256_hw.c`.
+
+#[cfg(not(target_arch = "arm"))]
+pub use sha2::Sha256;
+
+#[cfg(target_arch = "arm")]
+pub use hardware::Sha256;
+
+#[cfg(target_arch = "arm")]
+mod hardware {
+    use sha2::digest::consts::U32;
+    use sha2::digest::{FixedOutput, HashMarker, Output, OutputSizeUser, Reset, Update};
+
+    #[derive(Clone)]
+    pub struct Sha256(bitbox02_sys::sha256_hw_state_t);
+
+    impl Default for Sha256 {
+        fn default() -> Self {
+            let mut state = bitbox02_sys::sha256_hw_state_t::default();
+            unsafe { bitbox02_sys::sha256_hw_init(&mut state) };
+            Sha256(state)
+        }
+    }
+
+    impl HashMarker for Sha256 {}
+
+    impl OutputSizeUser for Sha256 {
+        type OutputSize = U32;
+    }
+
+    impl Update for Sha256 {
+        fn update(&mut self, data: &[u8]) {
+            unsafe { bitbox02_sys::sha256_hw_update(&mut self.0, data.as_ptr(), data.len() as _) }
+        }
+    }
+
+    impl FixedOutput for Sha256 {
+        fn finalize_into(mut self, out: &mut Output<Self>) {
+            unsafe { bitbox02_sys::sha256_hw_finish(&mut self.0, out.as_mut_ptr()) }
+        }
+    }
+
+    impl Reset for Sha256 {
+        fn reset(&mut self) {
+            unsafe { bitbox02_sys::sha256_hw_init(&mut self.0) }
+        }
+    }
+}
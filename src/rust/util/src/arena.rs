@@ -0,0 +1,274 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//! Bump arena for the short-lived allocations made while processing an API request.
+//!
+//! While a `Scope` is alive, the global allocator serves allocations from the arena, falling back
+//! to the heap if the arena is full. Freed arena memory is zeroed right away. The arena is only
+//! rewound once all of its allocations are freed, so allocations that outlive the request (e.g.
+//! the response waiting to be fetched by the host) are safe; they only delay the rewind.
+//!
+//! Allocations that are never freed, like lazily initialized statics, would keep the arena from
+//! ever being rewound again. They must be made inside `permanent()`, which serves them from the
+//! heap.
+
+use core::alloc::Layout;
+use core::cell::Cell;
+
+pub struct Arena {
+    buf: Cell<*mut u8>,
+    size: Cell<usize>,
+    // Bump pointer, offset into `buf`.
+    offset: Cell<usize>,
+    // Offset of the most recent allocation, which can be grown or freed in place.
+    last: Cell<usize>,
+    // Number of allocations in the arena that were not freed yet.
+    live: Cell<usize>,
+    // Number of nested active scopes.
+    depth: Cell<usize>,
+}
+
+/// Safety: this implements Sync even though it is not thread safe. This is okay, as we
+/// run only in a single thread in the BitBox02, and never allocate from interrupts.
+unsafe impl Sync for Arena {}
+
+/// The arena used by the global allocator.
+pub static ARENA: Arena = Arena::new();
+
+impl Default for Arena {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Arena {
+    pub const fn new() -> Self {
+        Arena {
+            buf: Cell::new(core::ptr::null_mut()),
+            size: Cell::new(0),
+            offset: Cell::new(0),
+            last: Cell::new(0),
+            live: Cell::new(0),
+            depth: Cell::new(0),
+        }
+    }
+
+    /// Hands the arena its backing memory. Can only be done once.
+    ///
+    /// # Safety
+    /// `buf` must be valid for reads and writes of `size` bytes for the rest of the program.
+    pub unsafe fn init(&self, buf: *mut u8, size: usize) {
+        if self.has_buffer() || buf.is_null() {
+            return;
+        }
+        self.buf.set(buf);
+        self.size.set(size);
+    }
+
+    pub fn has_buffer(&self) -> bool {
+        !self.buf.get().is_null()
+    }
+
+    /// True if allocations should currently be served from the arena.
+    pub fn is_active(&self) -> bool {
+        self.depth.get() > 0
+    }
+
+    /// True if `ptr` points into the arena.
+    pub fn contains(&self, ptr: *const u8) -> bool {
+        let start = self.buf.get() as usize;
+        let ptr = ptr as usize;
+        self.has_buffer() && ptr >= start && ptr < start + self.size.get()
+    }
+
+    /// Allocates from the arena. Returns `None` if no scope is active or the arena is full, in
+    /// which case the caller allocates on the heap.
+    pub fn alloc(&self, layout: Layout) -> Option<*mut u8> {
+        if !self.is_active() || !self.has_buffer() {
+            return None;
+        }
+        let start = self.buf.get() as usize;
+        let aligned = (start + self.offset.get() + layout.align() - 1) & !(layout.align() - 1);
+        let offset = aligned - start;
+        if offset + layout.size() > self.size.get() {
+            return None;
+        }
+        self.last.set(offset);
+        self.offset.set(offset + layout.size());
+        self.live.set(self.live.get() + 1);
+        Some(aligned as *mut u8)
+    }
+
+    /// Frees an arena allocation, zeroing its memory.
+    ///
+    /// # Safety
+    /// `ptr` must have been returned by `alloc()` of this arena with the same `layout`.
+    pub unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        crate::zero(core::slice::from_raw_parts_mut(ptr, layout.size()));
+        let offset = ptr as usize - self.buf.get() as usize;
+        self.live.set(self.live.get() - 1);
+        if self.live.get() == 0 {
+            // Everything was freed, rewind.
+            self.offset.set(0);
+            self.last.set(0);
+        } else if offset == self.last.get() && offset + layout.size() == self.offset.get() {
+            // The most recent allocation can be given back directly.
+            self.offset.set(offset);
+        }
+    }
+
+    /// Grows or shrinks the most recent arena allocation in place. Returns false if that is not
+    /// possible, in which case the caller has to move the allocation.
+    ///
+    /// # Safety
+    /// `ptr` must have been returned by `alloc()` of this arena with the same `layout`.
+    pub unsafe fn realloc_in_place(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> bool {
+        let offset = ptr as usize - self.buf.get() as usize;
+        if offset != self.last.get()
+            || offset + layout.size() != self.offset.get()
+            || offset + new_size > self.size.get()
+        {
+            return false;
+        }
+        if new_size < layout.size() {
+            crate::zero(core::slice::from_raw_parts_mut(
+                ptr.add(new_size),
+                layout.size() - new_size,
+            ));
+        }
+        self.offset.set(offset + new_size);
+        true
+    }
+
+    /// Runs `f` with the arena disabled, so that its allocations are served from the heap even if
+    /// a scope is active. See `permanent()`.
+    pub fn permanent<R>(&self, f: impl FnOnce() -> R) -> R {
+        let depth = self.depth.replace(0);
+        let result = f();
+        self.depth.set(depth);
+        result
+    }
+}
+
+/// Runs `f` with allocations served from the heap. Use this for allocations that live for the rest
+/// of the program or until some later request, e.g. when initializing a static. Such allocations
+/// must not come from the arena, as it can only be rewound once all of its allocations are freed.
+pub fn permanent<R>(f: impl FnOnce() -> R) -> R {
+    ARENA.permanent(f)
+}
+
+/// While alive, the global allocator serves allocations from `ARENA`. Scopes can be nested.
+pub struct Scope(());
+
+impl Scope {
+    pub fn enter() -> Self {
+        ARENA.depth.set(ARENA.depth.get() + 1);
+        Scope(())
+    }
+}
+
+impl Drop for Scope {
+    fn drop(&mut self) {
+        ARENA.depth.set(ARENA.depth.get() - 1);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn layout(size: usize, align: usize) -> Layout {
+        Layout::from_size_align(size, align).unwrap()
+    }
+
+    #[test]
+    fn test_arena() {
+        let arena = Arena::new();
+        let mut buf = [0xffu8; 64];
+        unsafe { arena.init(buf.as_mut_ptr(), buf.len()) };
+
+        // Inactive: nothing is served from the arena.
+        assert!(arena.alloc(layout(8, 1)).is_none());
+
+        arena.depth.set(1);
+        let a = arena.alloc(layout(3, 1)).unwrap();
+        assert!(arena.contains(a));
+        let b = arena.alloc(layout(8, 8)).unwrap();
+        assert_eq!(b as usize % 8, 0);
+        assert_eq!(b as usize - a as usize, 8);
+
+        // The last allocation grows in place, the first one does not.
+        unsafe {
+            assert!(arena.realloc_in_place(b, layout(8, 8), 16));
+            assert!(!arena.realloc_in_place(a, layout(3, 1), 4));
+        }
+
+        // Does not fit anymore.
+        assert!(arena.alloc(layout(60, 1)).is_none());
+
+        // Freeing the first allocation does not make its memory reusable yet.
+        unsafe { arena.dealloc(a, layout(3, 1)) };
+        assert_eq!(arena.offset.get(), 24);
+        // Freed memory is zeroed.
+        assert_eq!(&buf[..3], &[0, 0, 0]);
+
+        // Freeing the last allocation rewinds the arena.
+        unsafe { arena.dealloc(b, layout(16, 8)) };
+        assert_eq!(arena.offset.get(), 0);
+        assert!(buf[8..24].iter().all(|&b| b == 0));
+    }
+
+    #[test]
+    fn test_arena_permanent() {
+        extern crate std;
+        use std::boxed::Box;
+        use std::vec::Vec;
+
+        let arena = Arena::new();
+        let mut buf = [0u8; 64];
+        unsafe { arena.init(buf.as_mut_ptr(), buf.len()) };
+
+        // Allocates `size` bytes like the global allocator does, recording where it went.
+        let mut in_arena = Vec::new();
+        let mut allocate = |size: usize| match arena.alloc(layout(size, 8)) {
+            Some(ptr) => {
+                in_arena.push(ptr);
+                ptr
+            }
+            None => Box::into_raw(Box::new([0u8; 16])) as *mut u8,
+        };
+
+        // First request: a short-lived allocation, and a 'static one, e.g. a lazily initialized
+        // context.
+        arena.depth.set(1);
+        let request = allocate(16);
+        let static_ptr = arena.permanent(|| allocate(16));
+        assert!(arena.is_active());
+        assert!(!arena.contains(static_ptr));
+        unsafe { arena.dealloc(request, layout(16, 8)) };
+        arena.depth.set(0);
+        assert_eq!(arena.offset.get(), 0);
+
+        // Second request: the arena was rewound and is reused from the start.
+        arena.depth.set(1);
+        let request = allocate(16);
+        assert_eq!(request, buf.as_mut_ptr());
+        unsafe { arena.dealloc(request, layout(16, 8)) };
+        arena.depth.set(0);
+        assert_eq!(arena.offset.get(), 0);
+        assert_eq!(in_arena.len(), 2);
+
+        drop(unsafe { Box::from_raw(static_ptr as *mut [u8; 16]) });
+    }
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #![cfg_attr(not(test), no_std)]
+pub mod arena;
 pub mod ascii;
 pub mod bip32;
 pub mod c_types;
@@ -104,4 +104,5 @@ void screen_init(void)
         &font_font_a_11X10,
         SCREEN_WIDTH,
         SCREEN_HEIGHT);
+    UG_DriverRegisterBlit(oled_blit);
 }
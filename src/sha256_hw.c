@@ -0,0 +1,99 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sha256_hw.h"
+
+#include <hal_sha_sync.h>
+#include <util.h>
+
+#ifndef TESTING
+#include <driver_init.h>
+#endif
+
+#include <string.h>
+
+// The engine writes the intermediate hash to `digest`, which must be 128 byte aligned. Only one
+// computation runs at a time, so all of them share this context.
+COMPILER_ALIGNED(128)
+static struct sha_context _ctx;
+COMPILER_PACK_RESET()
+
+// The engine reads its input word by word. Unaligned input is copied here first.
+COMPILER_ALIGNED(4)
+static uint8_t _aligned_input[256];
+COMPILER_PACK_RESET()
+
+// The engine is also used by other code (e.g. pukcc.c), so it is configured again for every call.
+static void _load(const sha256_hw_state_t* state)
+{
+    sha_sync_sha256_start(&HASH_ALGORITHM_0, &_ctx, false);
+    memcpy(_ctx.digest, state->midstate, sizeof(state->midstate));
+    _ctx.total_len = state->total_len;
+    memcpy(_ctx.buffer, state->buffer, sizeof(state->buffer));
+}
+
+static void _store(sha256_hw_state_t* state)
+{
+    memcpy(state->midstate, _ctx.digest, sizeof(state->midstate));
+    state->total_len = _ctx.total_len;
+    memcpy(state->buffer, _ctx.buffer, sizeof(state->buffer));
+    util_zero(&_ctx, sizeof(_ctx));
+}
+
+void sha256_hw_init(sha256_hw_state_t* state)
+{
+    util_zero(state, sizeof(*state));
+    // Sets the initial hash value.
+    sha_sync_sha256_start(&HASH_ALGORITHM_0, &_ctx, false);
+    memcpy(state->midstate, _ctx.digest, sizeof(state->midstate));
+    util_zero(&_ctx, sizeof(_ctx));
+}
+
+void sha256_hw_update(sha256_hw_state_t* state, const uint8_t* data, size_t len)
+{
+    if (len == 0) {
+        return;
+    }
+    _load(state);
+    // Complete a partially buffered block first. Otherwise the HAL hands the engine the rest of
+    // `data` from an offset that depends on the buffered length, which can be unaligned.
+    const size_t left = state->total_len % 64;
+    if (left != 0) {
+        const size_t fill = MIN(len, 64 - left);
+        sha_sync_sha256_update(&HASH_ALGORITHM_0, data, fill);
+        data += fill;
+        len -= fill;
+    }
+    if (len > 0 && ((uintptr_t)data & 3) == 0) {
+        sha_sync_sha256_update(&HASH_ALGORITHM_0, data, len);
+    } else if (len > 0) {
+        while (len > 0) {
+            const size_t chunk_len = MIN(len, sizeof(_aligned_input));
+            memcpy(_aligned_input, data, chunk_len);
+            sha_sync_sha256_update(&HASH_ALGORITHM_0, _aligned_input, chunk_len);
+            data += chunk_len;
+            len -= chunk_len;
+        }
+        util_zero(_aligned_input, sizeof(_aligned_input));
+    }
+    _store(state);
+}
+
+void sha256_hw_finish(sha256_hw_state_t* state, uint8_t* out)
+{
+    _load(state);
+    sha_sync_sha256_finish(&HASH_ALGORITHM_0, out);
+    util_zero(&_ctx, sizeof(_ctx));
+    util_zero(state, sizeof(*state));
+}
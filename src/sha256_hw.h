@@ -0,0 +1,46 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _SHA256_HW_H_
+#define _SHA256_HW_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Midstate of a SHA-256 computation done with the MCU's hash engine (ICM).
+ *
+ * The engine has no state of its own between calls: each update loads the midstate from here and
+ * stores it back. Any number of these can be in progress at the same time, and they can be freely
+ * copied and moved.
+ */
+typedef struct {
+    // Intermediate hash value, in the byte order of the final digest.
+    uint8_t midstate[32];
+    // Number of bytes hashed so far.
+    uint64_t total_len;
+    // Input not yet processed, `total_len % 64` bytes.
+    uint8_t buffer[64];
+} sha256_hw_state_t;
+
+void sha256_hw_init(sha256_hw_state_t* state);
+
+void sha256_hw_update(sha256_hw_state_t* state, const uint8_t* data, size_t len);
+
+/**
+ * Writes the 32 byte digest to `out`. `state` is zeroed and must be initialized again to be reused.
+ */
+void sha256_hw_finish(sha256_hw_state_t* state, uint8_t* out);
+
+#endif
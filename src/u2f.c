@@ -19,6 +19,7 @@
 #include <hardfault.h>
 #include <keystore.h>
 #include <memory/memory.h>
+#include <p256.h>
 #include <random.h>
 #include <rust/rust.h>
 #include <securechip/securechip.h>
@@ -269,6 +270,8 @@ static void _version(const USB_APDU* a, Packet* out_packet)
 
 /**
  * Generates a key for the given app id, salted with the passed nonce.
+ * The HMACs are keyed with the U2F seed, whose midstates are retained by the keystore while it is
+ * unlocked, so only the per-appId work is done here.
  * @param[in] appId The app id of the RP which requests a registration or authentication process.
  * @param[in] nonce A random nonce with which the seed for the private key is salted.
  * @param[out] privkey The generated private key. Size must be HMAC_SHA256_LEN.
@@ -282,26 +285,17 @@ USE_RESULT static bool _keyhandle_gen(
     uint8_t* mac)
 {
     uint8_t hmac_in[U2F_APPID_SIZE + U2F_NONCE_LENGTH];
-    uint8_t seed[32];
-    UTIL_CLEANUP_32(seed);
-    if (!keystore_get_u2f_seed(seed)) {
-        return false;
-    }
 
     // Concatenate AppId and Nonce as input for the first HMAC round
     memcpy(hmac_in, appId, U2F_APPID_SIZE);
     memcpy(hmac_in + U2F_APPID_SIZE, nonce, U2F_NONCE_LENGTH);
-    int res = wally_hmac_sha256(
-        seed, KEYSTORE_U2F_SEED_LENGTH, hmac_in, sizeof(hmac_in), privkey, HMAC_SHA256_LEN);
-    if (res != WALLY_OK) {
+    if (!keystore_u2f_hmac(hmac_in, sizeof(hmac_in), privkey)) {
         return false;
     }
 
     // Concatenate AppId and privkey for the second HMAC round
     memcpy(hmac_in + U2F_APPID_SIZE, privkey, HMAC_SHA256_LEN);
-    res = wally_hmac_sha256(
-        seed, KEYSTORE_U2F_SEED_LENGTH, hmac_in, sizeof(hmac_in), mac, HMAC_SHA256_LEN);
-    if (res != WALLY_OK) {
+    if (!keystore_u2f_hmac(hmac_in, sizeof(hmac_in), mac)) {
         return false;
     }
     return true;
@@ -480,9 +474,7 @@ static void _register_continue(const USB_APDU* apdu, Packet* out_packet)
         if (!_keyhandle_gen(reg_request->appId, nonce, privkey, mac)) {
             continue;
         }
-        rust_p256_pubkey(
-            rust_util_bytes(privkey, sizeof(privkey)),
-            rust_util_bytes_mut((uint8_t*)&response->pubKey.x, 64));
+        p256_pubkey(privkey, (uint8_t*)&response->pubKey.x);
         break;
     }
 
@@ -505,10 +497,7 @@ static void _register_continue(const USB_APDU* apdu, Packet* out_packet)
     uint8_t hash[SHA256_LEN] = {0};
     wally_sha256((uint8_t*)&sig_base, sizeof(sig_base), hash, SHA256_LEN);
 
-    rust_p256_sign(
-        rust_util_bytes(U2F_ATT_PRIV_KEY, sizeof(U2F_ATT_PRIV_KEY)),
-        rust_util_bytes(hash, sizeof(hash)),
-        rust_util_bytes_mut(sig, sizeof(sig)));
+    p256_sign(U2F_ATT_PRIV_KEY, hash, sig);
 
     uint8_t* resp_sig = response->keyHandleCertSig + response->keyHandleLen + sizeof(U2F_ATT_CERT);
     int der_len = _sig_to_der(sig, resp_sig);
@@ -688,10 +677,7 @@ static void _authenticate_continue(const USB_APDU* apdu, Packet* out_packet)
     uint8_t hash[SHA256_LEN] = {0};
     wally_sha256((uint8_t*)&sig_base, sizeof(sig_base), hash, SHA256_LEN);
 
-    rust_p256_sign(
-        rust_util_bytes(privkey, sizeof(privkey)),
-        rust_util_bytes(hash, sizeof(hash)),
-        rust_util_bytes_mut(sig, sizeof(sig)));
+    p256_sign(privkey, hash, sig);
     int der_len = _sig_to_der(sig, response->sig);
     size_t auth_packet_len = sizeof(U2F_AUTHENTICATE_RESP) - U2F_MAX_EC_SIG_SIZE + der_len;
 
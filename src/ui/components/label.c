@@ -39,9 +39,15 @@ typedef struct {
     int16_t text_position_last;
     uint8_t xoffset;
     uint8_t yoffset;
+    // Line breaks and line positions of `text`, computed when the text changes, so rendering a
+    // frame does not have to measure and break the text again.
+    UG_LAYOUT layout;
+    // Horizontal position the layout was computed for, see `_layout_x()`.
+    int16_t layout_x;
 } data_t;
 
 static void _measure_label_dimensions(component_t* label);
+static void _update_layout(component_t* label);
 
 void label_update(component_t* component, const char* text)
 {
@@ -53,6 +59,7 @@ void label_update(component_t* component, const char* text)
     }
     _measure_label_dimensions(component);
     if (component->parent == NULL) {
+        _update_layout(component);
         return;
     }
     component_t* parent = component->parent;
@@ -89,6 +96,47 @@ void label_update(component_t* component, const char* text)
     }
     component->position.top += data->yoffset;
     component->position.left += data->xoffset;
+    _update_layout(component);
+}
+
+static bool _is_centered(const data_t* data)
+{
+    return data->position == CENTER || data->position == CENTER_TOP ||
+           data->position == CENTER_BOTTOM;
+}
+
+// The line breaks of labels that are neither scrollable nor centered depend on where the text
+// starts horizontally.
+static int16_t _layout_x(const component_t* label)
+{
+    const data_t* data = (const data_t*)label->data;
+    if (data->scrollable || _is_centered(data)) {
+        return 0;
+    }
+    return label->position.left + data->text_position;
+}
+
+static void _update_layout(component_t* label)
+{
+    data_t* data = (data_t*)label->data;
+    UG_LAYOUT_MODE mode = UG_LAYOUT_BREAK;
+    if (data->scrollable) {
+        mode = UG_LAYOUT_NO_BREAK;
+    } else if (_is_centered(data)) {
+        mode = UG_LAYOUT_CENTERED;
+    }
+    data->layout_x = _layout_x(label);
+    UG_FontSetVSpace(2);
+    UG_FontSelect(data->font);
+    UG_LayoutString(
+        &data->layout,
+        data->text,
+        mode,
+        data->layout_x,
+        label->dimension.width,
+        label->dimension.height,
+        data->upside_down);
+    UG_FontSetVSpace(0);
 }
 
 static void _render(component_t* component)
@@ -107,30 +155,24 @@ static void _render(component_t* component)
         }
     }
     // Label
+    if (_layout_x(component) != data->layout_x) {
+        // The label was moved since the last update.
+        _update_layout(component);
+    }
     UG_FontSetVSpace(2);
     UG_FontSelect(data->font);
     if (data->scrollable) {
-        UG_PutStringNoBreak(
-            data->text_position - component->dimension.width / 2,
-            component->position.top,
+        UG_PutLayout(
+            &data->layout,
             data->text,
-            data->upside_down);
-    } else if (
-        data->position == CENTER || data->position == CENTER_TOP ||
-        data->position == CENTER_BOTTOM) {
-        UG_PutStringCentered(
-            component->position.left + data->text_position,
-            component->position.top,
-            component->dimension.width,
-            component->dimension.height,
-            data->text,
-            data->upside_down);
+            data->text_position - component->dimension.width / 2,
+            component->position.top);
     } else {
-        UG_PutString(
-            component->position.left + data->text_position,
-            component->position.top,
+        UG_PutLayout(
+            &data->layout,
             data->text,
-            data->upside_down);
+            component->position.left + data->text_position,
+            component->position.top);
     }
     UG_FontSetVSpace(0);
 }
@@ -194,9 +236,7 @@ void _measure_label_dimensions(component_t* label)
             // Do not scroll if text already fits in the screen
             data->scrollable = false;
         }
-    } else if (
-        data->position == CENTER || data->position == CENTER_TOP ||
-        data->position == CENTER_BOTTOM) {
+    } else if (_is_centered(data)) {
         UG_MeasureStringCentered(&(label->dimension.width), &(label->dimension.height), data->text);
     } else {
         UG_MeasureString(&(label->dimension.width), &(label->dimension.height), data->text);
@@ -28,6 +28,7 @@
 #include <ui/fonts/password_11X12.h>
 #include <ui/ugui/ugui.h>
 #include <ui/ui_util.h>
+#include <ui/word_prefix.h>
 #include <util.h>
 
 #include <stdbool.h>
@@ -246,6 +247,12 @@ static void _render(component_t* component)
     }
 }
 
+// Range of the words in the wordlist starting with the current input. Only call if wordlist != NULL.
+static word_prefix_range_t _wordlist_range(const data_t* data)
+{
+    return word_prefix_range(data->wordlist, data->wordlist_size, data->string, data->string_index);
+}
+
 // if the current input uniquely identifies a word from the wordlist by prefix, we autocomplete the
 // word.
 static void _maybe_autocomplete(component_t* trinary_input_string)
@@ -254,21 +261,13 @@ static void _maybe_autocomplete(component_t* trinary_input_string)
     if (data->wordlist == NULL) {
         return;
     }
-    // initial value means no word was found yet.
-    size_t found_word_idx = data->wordlist_size;
-    for (size_t word_idx = 0; word_idx < data->wordlist_size; word_idx++) {
-        const char* word = data->wordlist[word_idx];
-        bool is_prefix = strncmp(data->string, word, data->string_index) == 0;
-        if (is_prefix) {
-            if (found_word_idx != data->wordlist_size) {
-                // Not unique.
-                return;
-            }
-            found_word_idx = word_idx;
-        }
+    const word_prefix_range_t range = _wordlist_range(data);
+    if (range.end - range.begin != 1) {
+        // No word found or not unique.
+        return;
     }
     data->string_index =
-        snprintf(data->string, sizeof(data->string), "%s", data->wordlist[found_word_idx]);
+        snprintf(data->string, sizeof(data->string), "%s", data->wordlist[range.begin]);
 }
 
 static void _set_alphabet(component_t* trinary_input_string)
@@ -281,19 +280,8 @@ static void _set_alphabet(component_t* trinary_input_string)
         // the charset to select the next letter wil be "eio".
         // The wordlist is assumed to be sorted and only have 'a-z' characters.
         char charset[27] = {0};
-        for (size_t word_idx = 0; word_idx < data->wordlist_size; word_idx++) {
-            const char* word = data->wordlist[word_idx];
-            bool is_prefix = strncmp(data->string, word, data->string_index) == 0;
-            if (is_prefix) {
-                if (strlen(word) > data->string_index) {
-                    const char include = word[data->string_index];
-                    if (strchr(charset, include) == NULL) {
-                        charset[strlen(charset)] = include;
-                    }
-                }
-            }
-        }
-        // Since wordlist is sorted, charset is sorted automatically.
+        word_prefix_next_chars(
+            data->wordlist, _wordlist_range(data), data->string_index, charset, sizeof(charset));
         trinary_input_char_set_alphabet(trinary_char, charset, 1);
     } else if (data->number_input) {
         trinary_input_char_set_alphabet(trinary_char, _digits, 1);
@@ -326,14 +314,9 @@ static void _set_can_confirm(component_t* trinary_input_string)
         data->can_confirm = true;
         return;
     }
-    data->can_confirm = false;
     // Can only confirm if the entered word matches a word in the wordlist.
-    for (size_t i = 0; i < data->wordlist_size; i++) {
-        if (STREQ(data->wordlist[i], data->string)) {
-            data->can_confirm = true;
-            return;
-        }
-    }
+    data->can_confirm =
+        word_prefix_is_word(data->wordlist, _wordlist_range(data), data->string_index);
 }
 
 static void _on_event(const event_t* event, component_t* component)
@@ -514,13 +497,13 @@ void trinary_input_string_set_input(component_t* trinary_input_string, const cha
     if (data->wordlist == NULL) {
         return;
     }
-    for (size_t i = 0; i < data->wordlist_size; i++) {
-        if (STREQ(data->wordlist[i], word)) {
-            data->string_index = snprintf(data->string, sizeof(data->string), "%s", word);
-            _set_alphabet(trinary_input_string);
-            _set_can_confirm(trinary_input_string);
-            return;
-        }
+    const size_t word_len = strlen(word);
+    const word_prefix_range_t range =
+        word_prefix_range(data->wordlist, data->wordlist_size, word, word_len);
+    if (!word_prefix_is_word(data->wordlist, range, word_len)) {
+        Abort("trinary_input_string_set_input");
     }
-    Abort("trinary_input_string_set_input");
+    data->string_index = snprintf(data->string, sizeof(data->string), "%s", word);
+    _set_alphabet(trinary_input_string);
+    _set_can_confirm(trinary_input_string);
 }
@@ -24,7 +24,8 @@
 
 typedef struct {
     const char* title;
-    // Restrict and autocomplete to this list of words. Set to NULL to allow arbitrary input.
+    // Restrict and autocomplete to this list of words. Set to NULL to allow arbitrary input. Must be
+    // sorted and contain only the characters a-z.
     const char* const* wordlist;
     // If true, the user can enter numbers only.
     bool number_input;
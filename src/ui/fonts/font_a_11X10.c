@@ -102,6 +102,106 @@ static UG_FONT_DATA unsigned char fontBits_font_a_11X10[95][20] = {
   {0x02,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x02,0x00 }, // 0x7D '}'
   {0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }  // 0x7E '~'
 };
+// Column atlas, see UG_FONT.columns. Generated by scripts/font_atlas, do not edit.
+#if !defined(BOOTLOADER)
+static UG_FONT_DATA unsigned char fontColumns_font_a_11X10[95][22] = {
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x20 ' '
+  {0xBF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x21 '!'
+  {0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x22 '"'
+  {0xE4,0x00,0x3C,0x00,0xE7,0x00,0x3C,0x00,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x23 '#'
+  {0x46,0x00,0x89,0x00,0xFF,0x01,0x89,0x00,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x24 '$'
+  {0x06,0x00,0x09,0x00,0x89,0x00,0x66,0x00,0x18,0x00,0x66,0x00,0x91,0x00,0x90,0x00,0x60,0x00,0x00,0x00,0x00,0x00 }, // 0x25 '%'
+  {0x60,0x00,0x96,0x00,0x89,0x00,0x99,0x00,0x66,0x00,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x26 '&'
+  {0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x27 '''
+  {0xFC,0x00,0x02,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x28 '('
+  {0x01,0x02,0x02,0x01,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x29 ')'
+  {0x0A,0x00,0x07,0x00,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2A '*'
+  {0x10,0x00,0x10,0x00,0x7C,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2B '+'
+  {0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2C ','
+  {0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2D '-'
+  {0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2E '.'
+  {0xC0,0x00,0x3C,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2F '/'
+  {0x7E,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x30 '0'
+  {0x04,0x00,0x02,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x31 '1'
+  {0x82,0x00,0xC1,0x00,0xA1,0x00,0x91,0x00,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x32 '2'
+  {0x42,0x00,0x81,0x00,0x89,0x00,0x89,0x00,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x33 '3'
+  {0x30,0x00,0x2C,0x00,0x22,0x00,0xFF,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x34 '4'
+  {0x4C,0x00,0x8B,0x00,0x89,0x00,0x89,0x00,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x35 '5'
+  {0x7E,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x36 '6'
+  {0x01,0x00,0xE1,0x00,0x19,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x37 '7'
+  {0x76,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x38 '8'
+  {0x4E,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x39 '9'
+  {0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3A ':'
+  {0x84,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3B ';'
+  {0x10,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3C '<'
+  {0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3D '='
+  {0x44,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3E '>'
+  {0x02,0x00,0x01,0x00,0xB1,0x00,0x09,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3F '?'
+  {0xF8,0x00,0x06,0x01,0x72,0x02,0x89,0x02,0x85,0x02,0x45,0x02,0xF9,0x02,0x8D,0x02,0x42,0x02,0x3C,0x01,0x00,0x00 }, // 0x40 '@'
+  {0xC0,0x00,0x30,0x00,0x2E,0x00,0x21,0x00,0x2E,0x00,0x30,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x41 'A'
+  {0xFF,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x42 'B'
+  {0x3C,0x00,0x42,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x43 'C'
+  {0xFF,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x42,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x44 'D'
+  {0xFF,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x45 'E'
+  {0xFF,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x46 'F'
+  {0x3C,0x00,0x42,0x00,0x81,0x00,0x81,0x00,0x91,0x00,0x52,0x00,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x47 'G'
+  {0xFF,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x48 'H'
+  {0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x49 'I'
+  {0x60,0x00,0x80,0x00,0x80,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4A 'J'
+  {0xFF,0x00,0x10,0x00,0x08,0x00,0x1C,0x00,0x62,0x00,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4B 'K'
+  {0xFF,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4C 'L'
+  {0xFF,0x00,0x06,0x00,0x38,0x00,0xC0,0x00,0x38,0x00,0x06,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4D 'M'
+  {0xFF,0x00,0x02,0x00,0x0C,0x00,0x30,0x00,0x40,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4E 'N'
+  {0x3C,0x00,0x42,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x42,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4F 'O'
+  {0xFF,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x50 'P'
+  {0x3C,0x00,0x42,0x00,0x81,0x00,0xA1,0x00,0xA1,0x00,0xC2,0x00,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x51 'Q'
+  {0xFF,0x00,0x09,0x00,0x09,0x00,0x19,0x00,0x69,0x00,0x86,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x52 'R'
+  {0x46,0x00,0x89,0x00,0x89,0x00,0x91,0x00,0x91,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x53 'S'
+  {0x01,0x00,0x01,0x00,0xFF,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x54 'T'
+  {0x7F,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x55 'U'
+  {0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x56 'V'
+  {0x03,0x00,0x3C,0x00,0xC0,0x00,0x30,0x00,0x0E,0x00,0x01,0x00,0x0E,0x00,0x30,0x00,0xC0,0x00,0x3C,0x00,0x03,0x00 }, // 0x57 'W'
+  {0x81,0x00,0x66,0x00,0x18,0x00,0x18,0x00,0x66,0x00,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x58 'X'
+  {0x01,0x00,0x06,0x00,0x08,0x00,0xF0,0x00,0x08,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x59 'Y'
+  {0x80,0x00,0xC1,0x00,0xB1,0x00,0x8D,0x00,0x83,0x00,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5A 'Z'
+  {0xFF,0x03,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5B '['
+  {0x03,0x00,0x3C,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5C '\'
+  {0x01,0x02,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5D ']'
+  {0x08,0x00,0x06,0x00,0x01,0x00,0x06,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5E '^'
+  {0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5F '_'
+  {0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x60 '`'
+  {0xE8,0x00,0x94,0x00,0x94,0x00,0x54,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x61 'a'
+  {0xFF,0x00,0x48,0x00,0x84,0x00,0x84,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x62 'b'
+  {0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x63 'c'
+  {0x78,0x00,0x84,0x00,0x84,0x00,0x48,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x64 'd'
+  {0x78,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x65 'e'
+  {0x04,0x00,0xFE,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x66 'f'
+  {0x78,0x02,0x84,0x02,0x84,0x02,0x48,0x02,0xFC,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x67 'g'
+  {0xFF,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x68 'h'
+  {0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x69 'i'
+  {0x00,0x01,0xFD,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6A 'j'
+  {0xFF,0x00,0x30,0x00,0x68,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6B 'k'
+  {0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6C 'l'
+  {0xFC,0x00,0x08,0x00,0x04,0x00,0xFC,0x00,0x04,0x00,0x04,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6D 'm'
+  {0xFC,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6E 'n'
+  {0x78,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6F 'o'
+  {0xFC,0x03,0x48,0x00,0x84,0x00,0x84,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x70 'p'
+  {0x78,0x00,0x84,0x00,0x84,0x00,0x48,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x71 'q'
+  {0xFC,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x72 'r'
+  {0x48,0x00,0x94,0x00,0x94,0x00,0xA4,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x73 's'
+  {0x04,0x00,0xFF,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x74 't'
+  {0x7C,0x00,0x80,0x00,0x80,0x00,0x40,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x75 'u'
+  {0x0C,0x00,0x30,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x76 'v'
+  {0x0C,0x00,0x30,0x00,0xC0,0x00,0x38,0x00,0x04,0x00,0x38,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x00,0x00,0x00,0x00 }, // 0x77 'w'
+  {0x84,0x00,0x48,0x00,0x30,0x00,0x48,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x78 'x'
+  {0x0C,0x00,0x30,0x02,0xC0,0x01,0x30,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x79 'y'
+  {0x84,0x00,0xC4,0x00,0xB4,0x00,0x8C,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7A 'z'
+  {0x10,0x00,0xEE,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7B '{'
+  {0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7C '|'
+  {0x00,0x00,0x01,0x02,0xEE,0x01,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7D '}'
+  {0x18,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }  // 0x7E '~'
+};
+#endif
 static UG_U8 fontWidths_font_a_11X10[] = {
 3,2,4,6,6,10,7,2,4,4,4,6,3,4,3,3,6,6,6,6,6,6,6,6,6,6,3,3,6,6,6,6,11,8,7,7,7,6,6,8,7,2,5,7,6,8,7,8,6,8,7,7,6,7,8,11,7,8,7,3,3,3,5,6,4,6,6,6,6,6,4,6,6,2,3,5,2,8,6,6,6,6,4,6,4,6,6,10,6,6,6,4,2,4,6};
-const UG_FONT font_font_a_11X10 = { (unsigned char*)fontBits_font_a_11X10, FONT_TYPE_1BPP, 11, 10, 32, 126, fontWidths_font_a_11X10 };
+const UG_FONT font_font_a_11X10 = { (unsigned char*)fontBits_font_a_11X10, FONT_TYPE_1BPP, 11, 10, 32, 126, fontWidths_font_a_11X10, UG_FONT_COLUMNS(fontColumns_font_a_11X10, 11) };
@@ -99,7 +99,107 @@ static UG_FONT_DATA unsigned char fontBits_password_11X12[95][24] = {
     {0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00 }, // 0x7D '}'
     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } // 0x7E '~'
 };
+// Column atlas, see UG_FONT.columns. Generated by scripts/font_atlas, do not edit.
+#if !defined(BOOTLOADER)
+static UG_FONT_DATA unsigned char fontColumns_password_11X12[95][24] = {
+  {0x80,0x07,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x20 (0x2423) '#'
+  {0x00,0x00,0x7F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x21 '!'
+  {0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x22 '"'
+  {0x24,0x00,0xA4,0x01,0x7C,0x00,0xA7,0x01,0x7C,0x00,0x27,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x23 '#'
+  {0x00,0x00,0xCE,0x00,0x11,0x01,0xFF,0x03,0x11,0x01,0xE2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x24 '$'
+  {0x00,0x00,0x0E,0x00,0x11,0x00,0x11,0x01,0xCE,0x00,0x38,0x00,0xE6,0x00,0x11,0x01,0x10,0x01,0xE0,0x00,0x00,0x00,0x00,0x00 }, // 0x25 '%'
+  {0x00,0x00,0xE0,0x00,0x1E,0x01,0x11,0x01,0x29,0x01,0xC6,0x00,0xA0,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x26 '&'
+  {0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x27 '''
+  {0x00,0x00,0xF8,0x00,0x06,0x03,0x01,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x28 '('
+  {0x01,0x04,0x06,0x03,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x29 ')'
+  {0x02,0x00,0x0A,0x00,0x07,0x00,0x0A,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2A '*'
+  {0x00,0x00,0x10,0x00,0x10,0x00,0x7C,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2B '+'
+  {0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2C ','
+  {0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2D '-'
+  {0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2E '.'
+  {0x80,0x01,0x7C,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2F '/'
+  {0x00,0x00,0xFE,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x30 '0'
+  {0x00,0x00,0x04,0x00,0x02,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x31 '1'
+  {0x00,0x00,0x02,0x01,0x81,0x01,0x41,0x01,0x31,0x01,0x0E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x32 '2'
+  {0x00,0x00,0x82,0x00,0x01,0x01,0x11,0x01,0x11,0x01,0xEE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x33 '3'
+  {0x00,0x00,0x60,0x00,0x58,0x00,0x46,0x00,0xFF,0x01,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x34 '4'
+  {0x00,0x00,0x9C,0x00,0x0B,0x01,0x09,0x01,0x09,0x01,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x35 '5'
+  {0x00,0x00,0xFE,0x00,0x11,0x01,0x09,0x01,0x09,0x01,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x36 '6'
+  {0x00,0x00,0x01,0x00,0xC1,0x01,0x39,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x37 '7'
+  {0x00,0x00,0xEE,0x00,0x11,0x01,0x11,0x01,0x11,0x01,0xEE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x38 '8'
+  {0x00,0x00,0x9E,0x00,0x21,0x01,0x21,0x01,0x11,0x01,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x39 '9'
+  {0x00,0x00,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3A ':'
+  {0x00,0x00,0x04,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3B ';'
+  {0x00,0x00,0x10,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3C '<'
+  {0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3D '='
+  {0x00,0x00,0x44,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3E '>'
+  {0x00,0x00,0x06,0x00,0x01,0x00,0x61,0x01,0x11,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3F '?'
+  {0x00,0x00,0xF0,0x01,0x0C,0x02,0xE2,0x04,0x12,0x09,0x09,0x09,0x09,0x09,0xF1,0x09,0x19,0x09,0x02,0x05,0x86,0x04,0x78,0x02 }, // 0x40 '@'
+  {0x80,0x01,0x70,0x00,0x2E,0x00,0x21,0x00,0x2E,0x00,0x70,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x41 'A'
+  {0x00,0x00,0xFF,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x42 'B'
+  {0x00,0x00,0x7C,0x00,0x82,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x82,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x43 'C'
+  {0x00,0x00,0xFF,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x82,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x44 'D'
+  {0x00,0x00,0xFF,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x45 'E'
+  {0x00,0x00,0xFF,0x01,0x11,0x00,0x11,0x00,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x46 'F'
+  {0x00,0x00,0x7C,0x00,0x82,0x00,0x01,0x01,0x01,0x01,0x11,0x01,0x92,0x00,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x47 'G'
+  {0x00,0x00,0xFF,0x01,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x48 'H'
+  {0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x49 'I'
+  {0xC0,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4A 'J'
+  {0x00,0x00,0xFF,0x01,0x20,0x00,0x10,0x00,0x28,0x00,0x44,0x00,0x82,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4B 'K'
+  {0x00,0x00,0xFF,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4C 'L'
+  {0x00,0x00,0xFF,0x01,0x06,0x00,0x78,0x00,0x80,0x01,0x78,0x00,0x06,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4D 'M'
+  {0x00,0x00,0xFF,0x01,0x02,0x00,0x0C,0x00,0x10,0x00,0x60,0x00,0x80,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4E 'N'
+  {0x00,0x00,0x7C,0x00,0x82,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x82,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4F 'O'
+  {0x00,0x00,0xFF,0x01,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x50 'P'
+  {0x00,0x00,0x7C,0x00,0x82,0x00,0x01,0x01,0x41,0x01,0x41,0x01,0x82,0x00,0x7C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x51 'Q'
+  {0x00,0x00,0xFF,0x01,0x11,0x00,0x11,0x00,0x11,0x00,0x31,0x00,0xD1,0x00,0x0E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x52 'R'
+  {0x00,0x00,0xCE,0x00,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x53 'S'
+  {0x01,0x00,0x01,0x00,0x01,0x00,0xFF,0x01,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x54 'T'
+  {0x00,0x00,0x7F,0x00,0x80,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x80,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x55 'U'
+  {0x03,0x00,0x1C,0x00,0x60,0x00,0x80,0x01,0x60,0x00,0x1C,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x56 'V'
+  {0x07,0x00,0x78,0x00,0x80,0x01,0x70,0x00,0x0E,0x00,0x01,0x00,0x0E,0x00,0x70,0x00,0x80,0x01,0x7C,0x00,0x03,0x00,0x00,0x00 }, // 0x57 'W'
+  {0x01,0x01,0xC6,0x00,0x28,0x00,0x10,0x00,0x28,0x00,0xC6,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x58 'X'
+  {0x01,0x00,0x06,0x00,0x08,0x00,0xF0,0x01,0x08,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x59 'Y'
+  {0x00,0x01,0x81,0x01,0x61,0x01,0x11,0x01,0x0D,0x01,0x03,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5A 'Z'
+  {0x00,0x00,0xFF,0x07,0x01,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5B '['
+  {0x03,0x00,0x7C,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5C '\'
+  {0x01,0x04,0xFF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5D ']'
+  {0x10,0x00,0x0E,0x00,0x01,0x00,0x0E,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5E '^'
+  {0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5F '_'
+  {0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x60 '`'
+  {0x00,0x00,0xC8,0x00,0x24,0x01,0x24,0x01,0xA4,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x61 'a'
+  {0x00,0x00,0xFF,0x01,0x88,0x00,0x04,0x01,0x04,0x01,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x62 'b'
+  {0x00,0x00,0xF8,0x00,0x04,0x01,0x04,0x01,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x63 'c'
+  {0x00,0x00,0xF8,0x00,0x04,0x01,0x04,0x01,0x88,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x64 'd'
+  {0x00,0x00,0xF8,0x00,0x24,0x01,0x24,0x01,0x24,0x01,0xB8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x65 'e'
+  {0x04,0x00,0xFE,0x01,0x05,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x66 'f'
+  {0x00,0x00,0xF8,0x04,0x04,0x05,0x04,0x05,0x88,0x04,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x67 'g'
+  {0x00,0x00,0xFF,0x01,0x08,0x00,0x04,0x00,0x04,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x68 'h'
+  {0x00,0x00,0xFD,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x69 'i'
+  {0x00,0x04,0xFD,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6A 'j'
+  {0x00,0x00,0xFF,0x01,0x20,0x00,0x30,0x00,0xC8,0x00,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6B 'k'
+  {0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6C 'l'
+  {0x00,0x00,0xFC,0x01,0x08,0x00,0x04,0x00,0x04,0x00,0xF8,0x01,0x08,0x00,0x04,0x00,0x04,0x00,0xF8,0x01,0x00,0x00,0x00,0x00 }, // 0x6D 'm'
+  {0x00,0x00,0xFC,0x01,0x08,0x00,0x04,0x00,0x04,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6E 'n'
+  {0x00,0x00,0xF8,0x00,0x04,0x01,0x04,0x01,0x04,0x01,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6F 'o'
+  {0x00,0x00,0xFC,0x07,0x88,0x00,0x04,0x01,0x04,0x01,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x70 'p'
+  {0x00,0x00,0xF8,0x00,0x04,0x01,0x04,0x01,0x88,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x71 'q'
+  {0x00,0x00,0xFC,0x01,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x72 'r'
+  {0x00,0x00,0x98,0x00,0x24,0x01,0x24,0x01,0x24,0x01,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x73 's'
+  {0x04,0x00,0xFF,0x01,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x74 't'
+  {0x00,0x00,0xFC,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0xFC,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x75 'u'
+  {0x0C,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x76 'v'
+  {0x0C,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0C,0x00,0x70,0x00,0x80,0x01,0x70,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x77 'w'
+  {0x04,0x01,0xD8,0x00,0x20,0x00,0xD8,0x00,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x78 'x'
+  {0x0C,0x00,0x70,0x04,0x80,0x03,0x70,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x79 'y'
+  {0x04,0x01,0xC4,0x01,0x24,0x01,0x1C,0x01,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7A 'z'
+  {0x20,0x00,0xDE,0x03,0x01,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7B '{'
+  {0x00,0x00,0xFF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7C '|'
+  {0x00,0x00,0x01,0x04,0xDE,0x03,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7D '}'
+  {0x00,0x00,0x20,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }  // 0x7E '~'
+};
+#endif
 static UG_U8 fontWidths_password_11X12[] = {
     7, 3, 4, 7, 7, 11, 8, 2, 4, 4, 5, 7, 3, 4, 3, 3, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 3, 3, 7, 7, 7, 7, 12, 7, 8, 9, 9, 8, 7, 9, 9, 3, 6, 8, 7, 9, 9, 9, 8, 9, 9, 8, 7, 9, 7, 11, 7, 7, 7, 3, 3, 3, 5, 7, 4, 7, 7, 6, 7, 7, 3, 7, 7, 3, 3, 6, 3, 11, 7, 7, 7, 7, 4, 7, 3, 7, 5, 9, 5, 5, 5, 4, 3, 4, 7
 };
-const UG_FONT font_password_11X12 = { (unsigned char *)fontBits_password_11X12, FONT_TYPE_1BPP, 11, 12, 32, 126, fontWidths_password_11X12 };
+const UG_FONT font_password_11X12 = { (unsigned char *)fontBits_password_11X12, FONT_TYPE_1BPP, 11, 12, 32, 126, fontWidths_password_11X12, UG_FONT_COLUMNS(fontColumns_password_11X12, 12) };
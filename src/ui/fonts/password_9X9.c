@@ -99,6 +99,106 @@ static UG_FONT_DATA unsigned char fontBits_password_9X9[95][18] = {
   {0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00 }, // 0x7D '}'
   {0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x00,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }  // 0x7E '~'
 };
+// Column atlas, see UG_FONT.columns. Generated by scripts/font_atlas, do not edit.
+#if !defined(BOOTLOADER)
+static UG_FONT_DATA unsigned char fontColumns_password_9X9[95][18] = {
+  {0x00,0x00,0xC0,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xC0,0x01,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x20 (0x2423) '#'
+  {0x00,0x00,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x21 '!'
+  {0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x22 '"'
+  {0x74,0x00,0x1F,0x00,0x74,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x23 '#'
+  {0x26,0x00,0x49,0x00,0xFF,0x00,0x49,0x00,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x24 '$'
+  {0x00,0x00,0x02,0x00,0x05,0x00,0x72,0x00,0x2E,0x00,0x51,0x00,0x20,0x00,0x00,0x00,0x00,0x00 }, // 0x25 '%'
+  {0x30,0x00,0x4E,0x00,0x49,0x00,0x59,0x00,0x26,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x26 '&'
+  {0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x27 '''
+  {0x7C,0x00,0x82,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x28 '('
+  {0x01,0x01,0x82,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x29 ')'
+  {0x05,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2A '*'
+  {0x10,0x00,0x10,0x00,0x7C,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2B '+'
+  {0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2C ','
+  {0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2D '-'
+  {0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2E '.'
+  {0x60,0x00,0x1C,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x2F '/'
+  {0x3E,0x00,0x41,0x00,0x41,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x30 '0'
+  {0x00,0x00,0x02,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x31 '1'
+  {0x42,0x00,0x61,0x00,0x59,0x00,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x32 '2'
+  {0x22,0x00,0x41,0x00,0x49,0x00,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x33 '3'
+  {0x18,0x00,0x14,0x00,0x12,0x00,0x7F,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x34 '4'
+  {0x2C,0x00,0x47,0x00,0x45,0x00,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x35 '5'
+  {0x3E,0x00,0x45,0x00,0x45,0x00,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x36 '6'
+  {0x01,0x00,0x71,0x00,0x0D,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x37 '7'
+  {0x36,0x00,0x49,0x00,0x49,0x00,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x38 '8'
+  {0x2E,0x00,0x51,0x00,0x51,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x39 '9'
+  {0x00,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3A ':'
+  {0x00,0x00,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3B ';'
+  {0x00,0x00,0x08,0x00,0x14,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3C '<'
+  {0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3D '='
+  {0x00,0x00,0x22,0x00,0x14,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3E '>'
+  {0x02,0x00,0x01,0x00,0x59,0x00,0x09,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x3F '?'
+  {0x00,0x00,0x7C,0x00,0x82,0x00,0x79,0x01,0x45,0x01,0x79,0x01,0x4D,0x01,0xA2,0x00,0x9C,0x00 }, // 0x40 '@'
+  {0x00,0x00,0x7C,0x00,0x12,0x00,0x11,0x00,0x12,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x41 'A'
+  {0x00,0x00,0x7F,0x00,0x49,0x00,0x49,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x42 'B'
+  {0x00,0x00,0x3E,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x43 'C'
+  {0x00,0x00,0x7F,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x44 'D'
+  {0x00,0x00,0x7F,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x45 'E'
+  {0x00,0x00,0x7F,0x00,0x09,0x00,0x09,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x46 'F'
+  {0x00,0x00,0x3E,0x00,0x41,0x00,0x41,0x00,0x49,0x00,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x47 'G'
+  {0x00,0x00,0x7F,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x48 'H'
+  {0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x49 'I'
+  {0x60,0x00,0x40,0x00,0x40,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4A 'J'
+  {0x00,0x00,0x7F,0x00,0x08,0x00,0x14,0x00,0x22,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4B 'K'
+  {0x00,0x00,0x7F,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4C 'L'
+  {0x7F,0x00,0x06,0x00,0x38,0x00,0x40,0x00,0x38,0x00,0x06,0x00,0x7F,0x00,0x00,0x00,0x00,0x00 }, // 0x4D 'M'
+  {0x00,0x00,0x7F,0x00,0x06,0x00,0x08,0x00,0x30,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4E 'N'
+  {0x00,0x00,0x3E,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x4F 'O'
+  {0x00,0x00,0x7F,0x00,0x09,0x00,0x09,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x50 'P'
+  {0x00,0x00,0x3E,0x00,0x41,0x00,0x41,0x00,0x61,0x00,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x51 'Q'
+  {0x00,0x00,0x7F,0x00,0x09,0x00,0x09,0x00,0x19,0x00,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x52 'R'
+  {0x00,0x00,0x26,0x00,0x49,0x00,0x49,0x00,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x53 'S'
+  {0x01,0x00,0x01,0x00,0x7F,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x54 'T'
+  {0x00,0x00,0x3F,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x55 'U'
+  {0x00,0x00,0x0F,0x00,0x30,0x00,0x40,0x00,0x30,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x56 'V'
+  {0x03,0x00,0x3C,0x00,0x40,0x00,0x3E,0x00,0x01,0x00,0x3E,0x00,0x40,0x00,0x3C,0x00,0x03,0x00 }, // 0x57 'W'
+  {0x41,0x00,0x36,0x00,0x08,0x00,0x36,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x58 'X'
+  {0x00,0x00,0x01,0x00,0x06,0x00,0x78,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x59 'Y'
+  {0x61,0x00,0x51,0x00,0x49,0x00,0x45,0x00,0x43,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5A 'Z'
+  {0x00,0x00,0xFF,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5B '['
+  {0x03,0x00,0x1C,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5C '\'
+  {0x01,0x01,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5D ']'
+  {0x06,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5E '^'
+  {0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x5F '_'
+  {0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x60 '`'
+  {0x64,0x00,0x54,0x00,0x54,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x61 'a'
+  {0x7F,0x00,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x62 'b'
+  {0x38,0x00,0x44,0x00,0x44,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x63 'c'
+  {0x38,0x00,0x44,0x00,0x44,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x64 'd'
+  {0x38,0x00,0x54,0x00,0x54,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x65 'e'
+  {0x04,0x00,0x7E,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x66 'f'
+  {0xB8,0x00,0x44,0x01,0x44,0x01,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x67 'g'
+  {0x7F,0x00,0x04,0x00,0x04,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x68 'h'
+  {0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x69 'i'
+  {0x00,0x01,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6A 'j'
+  {0x7F,0x00,0x10,0x00,0x38,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6B 'k'
+  {0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6C 'l'
+  {0x7C,0x00,0x04,0x00,0x04,0x00,0x7C,0x00,0x04,0x00,0x04,0x00,0x78,0x00,0x00,0x00,0x00,0x00 }, // 0x6D 'm'
+  {0x7C,0x00,0x04,0x00,0x04,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6E 'n'
+  {0x38,0x00,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x6F 'o'
+  {0xFC,0x01,0x44,0x00,0x44,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x70 'p'
+  {0x38,0x00,0x44,0x00,0x44,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x71 'q'
+  {0x7C,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x72 'r'
+  {0x48,0x00,0x54,0x00,0x54,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x73 's'
+  {0x7E,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x74 't'
+  {0x3C,0x00,0x40,0x00,0x40,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x75 'u'
+  {0x04,0x00,0x38,0x00,0x40,0x00,0x38,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x76 'v'
+  {0x3C,0x00,0x40,0x00,0x3C,0x00,0x40,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x77 'w'
+  {0x44,0x00,0x38,0x00,0x28,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x78 'x'
+  {0x04,0x00,0x38,0x01,0xC0,0x00,0x38,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x79 'y'
+  {0x64,0x00,0x54,0x00,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7A 'z'
+  {0x10,0x00,0xEF,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7B '{'
+  {0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7C '|'
+  {0x01,0x01,0xEF,0x01,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }, // 0x7D '}'
+  {0x18,0x00,0x08,0x00,0x10,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 }  // 0x7E '~'
+};
+#endif
 static UG_U8 fontWidths_password_9X9[] = {
 7,3,3,5,5,8,6,2,3,3,4,5,3,3,3,3,5,5,5,5,5,5,5,5,5,5,3,3,5,5,5,5,9,6,6,7,7,6,6,7,7,3,5,6,5,7,7,7,6,7,7,6,5,7,6,9,5,7,6,3,3,3,3,5,3,5,5,5,5,5,4,5,5,2,3,5,2,8,5,5,5,5,3,5,3,5,6,6,5,6,4,3,3,3,5};
-UG_FONT font_password_9X9 = { (unsigned char*)fontBits_password_9X9, FONT_TYPE_1BPP, 9, 9, 32, 126, fontWidths_password_9X9 };
+UG_FONT font_password_9X9 = { (unsigned char*)fontBits_password_9X9, FONT_TYPE_1BPP, 9, 9, 32, 126, fontWidths_password_9X9, UG_FONT_COLUMNS(fontColumns_password_9X9, 9) };
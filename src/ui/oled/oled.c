@@ -85,6 +85,18 @@ static volatile bool _enabled = false;
 struct bb02_display {
     void (*configure)(uint8_t*);
     void (*set_pixel)(uint16_t x, uint16_t y, uint8_t c);
+    void (*blit)(
+        int16_t x,
+        int16_t y,
+        const uint8_t* bits,
+        const uint8_t* columns,
+        int16_t width,
+        int16_t height,
+        uint16_t stride,
+        uint8_t fc,
+        uint8_t bc,
+        bool transparent,
+        bool inverted);
     void (*update)(void);
     void (*off)(void);
     void (*mirror)(bool);
@@ -93,6 +105,7 @@ struct bb02_display {
 static struct bb02_display bb02_display = {
     .configure = sh1107_configure,
     .set_pixel = sh1107_set_pixel,
+    .blit = sh1107_blit,
     .update = sh1107_update,
     .off = sh1107_off,
     .mirror = sh1107_mirror,
@@ -103,6 +116,7 @@ void oled_init(void)
     if (memory_get_screen_type() == MEMORY_SCREEN_TYPE_SSD1312) {
         bb02_display.configure = ssd1312_configure;
         bb02_display.set_pixel = ssd1312_set_pixel;
+        bb02_display.blit = ssd1312_blit;
         bb02_display.update = ssd1312_update;
         bb02_display.off = ssd1312_off;
         bb02_display.mirror = ssd1312_mirror;
@@ -152,6 +166,23 @@ void oled_set_pixel(uint16_t x, uint16_t y, uint8_t c)
     _frame_buffer_updated = true;
 }
 
+void oled_blit(
+    int16_t x,
+    int16_t y,
+    const uint8_t* bits,
+    const uint8_t* columns,
+    int16_t width,
+    int16_t height,
+    uint16_t stride,
+    uint8_t fc,
+    uint8_t bc,
+    bool transparent,
+    bool inverted)
+{
+    bb02_display.blit(x, y, bits, columns, width, height, stride, fc, bc, transparent, inverted);
+    _frame_buffer_updated = true;
+}
+
 void oled_off(void)
 {
     if (!_enabled) {
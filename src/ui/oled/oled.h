@@ -96,6 +96,23 @@ void oled_off(void);
  */
 void oled_set_pixel(uint16_t x, uint16_t y, uint8_t c);
 
+/**
+ * Draws a 1BPP glyph into the frame buffer, the fast path for text rendering. See `UG_BLIT_FUNC`
+ * in ugui.h for the parameters.
+ */
+void oled_blit(
+    int16_t x,
+    int16_t y,
+    const uint8_t* bits,
+    const uint8_t* columns,
+    int16_t width,
+    int16_t height,
+    uint16_t stride,
+    uint8_t fc,
+    uint8_t bc,
+    bool transparent,
+    bool inverted);
+
 /**
  * Set brightness (0x00..0xff).
  * 0x00 does not mean black, just loweset brightness.
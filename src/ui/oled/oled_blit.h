@@ -0,0 +1,84 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _OLED_BLIT_H_
+#define _OLED_BLIT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Draws `len` (at most 32) pixels, given as bits (least significant bit first), at the positions
+ * `pos` to `pos + len - 1` of a line of `limit` pixels (a multiple of 8). The pixels of the line
+ * are the bits of the bytes `line[0]`, `line[stride]`, `line[2 * stride]`, ... Pixels outside of
+ * the line are skipped. Set bits are drawn in `fc`, cleared bits in `bc` unless `transparent`.
+ */
+static inline void oled_blit_span(
+    uint8_t* line,
+    size_t stride,
+    int pos,
+    int limit,
+    uint32_t bits,
+    int len,
+    uint8_t fc,
+    uint8_t bc,
+    bool transparent)
+{
+    const uint32_t mask = len >= 32 ? 0xFFFFFFFFU : ((uint32_t)1 << len) - 1;
+    bits &= mask;
+    const uint32_t write_mask = transparent ? bits : mask;
+    const uint32_t value = (fc ? bits : 0) | (bc ? ~bits & mask : 0);
+    const int first = pos < 0 ? 0 : pos;
+    const int last = pos + len > limit ? limit - 1 : pos + len - 1;
+    if (first > last) {
+        return;
+    }
+    for (int byte = first / 8; byte <= last / 8; byte++) {
+        const int shift = pos - byte * 8;
+        const uint8_t byte_mask = (uint8_t)(shift >= 0 ? (uint64_t)write_mask << shift
+                                                       : (uint64_t)write_mask >> -shift);
+        const uint8_t byte_value =
+            (uint8_t)(shift >= 0 ? (uint64_t)value << shift : (uint64_t)value >> -shift);
+        uint8_t* b = &line[byte * stride];
+        *b = (uint8_t)((*b & ~byte_mask) | (byte_value & byte_mask));
+    }
+}
+
+/**
+ * Returns row `row` of a 1BPP glyph with rows of `stride` bytes as bits, least significant bit
+ * first. Columns of a font's column atlas are read the same way.
+ */
+static inline uint32_t oled_blit_glyph_row(const uint8_t* bits, uint16_t stride, int row)
+{
+    uint32_t result = 0;
+    for (uint16_t i = 0; i < stride && i < 4; i++) {
+        result |= (uint32_t)bits[row * stride + i] << (8 * i);
+    }
+    return result;
+}
+
+/**
+ * Reverses the order of the lowest `len` bits.
+ */
+static inline uint32_t oled_blit_reverse(uint32_t bits, int len)
+{
+    uint32_t result = 0;
+    for (int i = 0; i < len; i++) {
+        result = (result << 1) | ((bits >> i) & 1);
+    }
+    return result;
+}
+
+#endif
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "sh1107.h"
+#include "oled_blit.h"
 #include "oled_writer.h"
 
 // Specify the column address of display RAM 0-127
@@ -111,6 +112,45 @@ void sh1107_set_pixel(uint16_t x, uint16_t y, uint8_t c)
     }
 }
 
+/* Glyph rows map to pixel rows of the frame buffer with the same bit order, so every glyph row is
+ * written as a whole. The column atlas is not needed. */
+void sh1107_blit(
+    int16_t x,
+    int16_t y,
+    const uint8_t* bits,
+    const uint8_t* columns,
+    int16_t width,
+    int16_t height,
+    uint16_t stride,
+    uint8_t fc,
+    uint8_t bc,
+    bool transparent,
+    bool inverted)
+{
+    (void)columns;
+    for (int j = 0; j < height; j++) {
+        // Inverted glyphs are rotated by 180 degrees, see `_UG_PutGlyph()`.
+        const int row = inverted ? y + height - j : y + j;
+        if (row < 0 || row > 63) {
+            continue;
+        }
+        uint32_t row_bits = oled_blit_glyph_row(bits, stride, j);
+        if (inverted) {
+            row_bits = oled_blit_reverse(row_bits, width);
+        }
+        oled_blit_span(
+            &_frame_buffer[row * 16],
+            1,
+            inverted ? x + 1 : x,
+            128,
+            row_bits,
+            width,
+            fc,
+            bc,
+            transparent);
+    }
+}
+
 /* The SH1107 Segment/Common driver specifies that there are 16 pages per column
  * In total we should be writing 64*128 pixels. 8 bits per page, 16 pages per column and 64
  * columns */
@@ -25,6 +25,21 @@
 void sh1107_configure(uint8_t* buf);
 
 void sh1107_set_pixel(uint16_t x, uint16_t y, uint8_t c);
+/*
+ * Draws a 1BPP glyph directly into the frame buffer, see `UG_BLIT_FUNC` in ugui.h.
+ */
+void sh1107_blit(
+    int16_t x,
+    int16_t y,
+    const uint8_t* bits,
+    const uint8_t* columns,
+    int16_t width,
+    int16_t height,
+    uint16_t stride,
+    uint8_t fc,
+    uint8_t bc,
+    bool transparent,
+    bool inverted);
 void sh1107_update(void);
 void sh1107_mirror(bool mirror);
 void sh1107_off(void);
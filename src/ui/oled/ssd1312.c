@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "ssd1312.h"
+#include "oled_blit.h"
 #include "oled_writer.h"
 #include <stdbool.h>
 
@@ -113,6 +114,52 @@ void ssd1312_set_pixel(uint16_t x, uint16_t y, uint8_t c)
         _frame_buffer[p] &= ~(1 << (y % 8));
     }
 }
+/* Pixel columns are stored in bytes (8 rows per page), so every glyph column is written as a
+ * whole. The columns are taken from the font's column atlas if there is one, and are otherwise
+ * gathered from the glyph rows bit by bit. */
+void ssd1312_blit(
+    int16_t x,
+    int16_t y,
+    const uint8_t* bits,
+    const uint8_t* columns,
+    int16_t width,
+    int16_t height,
+    uint16_t stride,
+    uint8_t fc,
+    uint8_t bc,
+    bool transparent,
+    bool inverted)
+{
+    for (int i = 0; i < width; i++) {
+        // Inverted glyphs are rotated by 180 degrees, see `_UG_PutGlyph()`.
+        const int column = inverted ? x + width - i : x + i;
+        if (column < 0 || column > 127) {
+            continue;
+        }
+        uint32_t column_bits = 0;
+        if (columns != NULL) {
+            column_bits = oled_blit_glyph_row(columns, (uint16_t)((height + 7) / 8), i);
+        } else {
+            for (int j = 0; j < height; j++) {
+                column_bits |= ((bits[j * stride + i / 8] >> (i % 8)) & 1U) << j;
+            }
+        }
+        if (inverted) {
+            column_bits = oled_blit_reverse(column_bits, height);
+        }
+        oled_blit_span(
+            &_frame_buffer[column],
+            128,
+            inverted ? y + 1 : y,
+            64,
+            column_bits,
+            height,
+            fc,
+            bc,
+            transparent);
+    }
+}
+
 void ssd1312_update(void)
 {
     /* The SSD1312 has one page per 8 rows. One page is 128 bytes. Every byte is 8 rows */
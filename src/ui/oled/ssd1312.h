@@ -24,6 +24,21 @@
 void ssd1312_configure(uint8_t* buf);
 
 void ssd1312_set_pixel(uint16_t x, uint16_t y, uint8_t c);
+/*
+ * Draws a 1BPP glyph directly into the frame buffer, see `UG_BLIT_FUNC` in ugui.h.
+ */
+void ssd1312_blit(
+    int16_t x,
+    int16_t y,
+    const uint8_t* bits,
+    const uint8_t* columns,
+    int16_t width,
+    int16_t height,
+    uint16_t stride,
+    uint8_t fc,
+    uint8_t bc,
+    bool transparent,
+    bool inverted);
 void ssd1312_update(void);
 void ssd1312_mirror(bool mirror);
 void ssd1312_off(void);
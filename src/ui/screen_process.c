@@ -15,13 +15,36 @@
 #include "screen_process.h"
 #include "screen_stack.h"
 #include <hardfault.h>
+#include <main_loop_event.h>
 #include <touch/gestures.h>
 #include <ui/components/waiting.h>
 #include <ui/screen_process.h>
 #include <ui/screen_saver.h>
 #include <ui/ugui/ugui.h>
+#include <util.h>
 
-static uint8_t screen_frame_cnt = 0;
+#ifndef TESTING
+#include <hal_timer.h>
+#include <platform/driver_init.h>
+#endif
+
+// Number of frame timer ticks so far. Only written by the timer interrupt.
+static volatile uint32_t _frame_tick = 0;
+// Value of `_frame_tick` when the last frame was rendered.
+static uint32_t _rendered_tick = 0;
+// Set by `screen_process_defer_frame()`, cleared after every `screen_process()`.
+static bool _defer_frame = false;
+// Frame statistics since boot, logged on every screen change to tune SCREEN_FRAME_PERIOD_MS and
+// SCREEN_MAX_DEFERRED_FRAMES.
+static struct {
+    // Number of frames rendered.
+    uint32_t frames_rendered;
+    // Number of frame periods that passed without a frame, because the main loop was busy or
+    // rendering was deferred in favour of USB traffic.
+    uint32_t frames_dropped;
+    // Highest number of frame periods between two rendered frames.
+    uint32_t max_frame_gap;
+} _stats = {0};
 
 void ui_screen_render_component(component_t* component)
 {
@@ -58,13 +81,66 @@ component_t* screen_process_get_top_component(void)
     return result;
 }
 
-static void _screen_draw(component_t* component)
+#ifndef TESTING
+static void _frame_timer_cb(const struct timer_task* const timer_task)
+{
+    (void)timer_task;
+    _frame_tick++;
+    main_loop_event_wake();
+}
+#endif
+
+void screen_process_init(void)
+{
+#ifndef TESTING
+    static struct timer_task Timer_task;
+    Timer_task.interval = SCREEN_FRAME_PERIOD_MS;
+    Timer_task.cb = _frame_timer_cb;
+    Timer_task.mode = TIMER_TASK_REPEAT;
+    timer_stop(&TIMER_0);
+    timer_add_task(&TIMER_0, &Timer_task);
+    timer_start(&TIMER_0);
+#endif
+}
+
+void screen_process_defer_frame(void)
+{
+    _defer_frame = true;
+}
+
+/**
+ * Renders the component if a frame is due. A new component is rendered right away, so that screen
+ * transitions are not delayed. Otherwise, at most one frame is rendered per frame period; periods
+ * that passed without rendering, e.g. because the main loop was busy, are dropped, not caught up.
+ *
+ * @param[in] component Current on-screen component.
+ * @param[in] screen_new true if the component was not on screen before.
+ */
+static void _screen_draw(component_t* component, bool screen_new)
 {
-    if (screen_frame_cnt == SCREEN_FRAME_RATE) {
-        screen_frame_cnt = 0;
-        ui_screen_render_component(component);
+#ifdef TESTING
+    // There is no frame timer, every call is a frame.
+    _frame_tick++;
+#endif
+    const uint32_t frame_tick = _frame_tick;
+    const uint32_t elapsed = frame_tick - _rendered_tick;
+    if (!screen_new) {
+        if (elapsed == 0) {
+            return;
+        }
+        if (_defer_frame && elapsed < SCREEN_MAX_DEFERRED_FRAMES) {
+            return;
+        }
+    }
+    ui_screen_render_component(component);
+    _rendered_tick = frame_tick;
+    _stats.frames_rendered++;
+    if (elapsed > 1) {
+        _stats.frames_dropped += elapsed - 1;
+    }
+    if (elapsed > _stats.max_frame_gap) {
+        _stats.max_frame_gap = elapsed;
     }
-    screen_frame_cnt++;
 }
 
 /**
@@ -89,13 +165,21 @@ void screen_process(void)
     screen_saver_process();
 
     component_t* component = screen_process_get_top_component();
-    _screen_draw(component);
+    bool screen_new = _screen_has_changed(component);
+    if (screen_new) {
+        util_log(
+            "frames: %lu rendered, %lu dropped, max gap %lu",
+            (unsigned long)_stats.frames_rendered,
+            (unsigned long)_stats.frames_dropped,
+            (unsigned long)_stats.max_frame_gap);
+    }
+    _screen_draw(component, screen_new);
+    _defer_frame = false;
 
     /*
      * If we have changed activity, the gestures
      * detection must start over.
      */
-    bool screen_new = _screen_has_changed(component);
     gestures_detect(screen_new, component->emit_without_release);
 
     ui_screen_stack_cleanup();
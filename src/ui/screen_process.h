@@ -36,9 +36,29 @@ component_t* screen_process_get_top_component(void);
 void screen_process(void);
 
 /**
- * Period of screen updates.
- * The screen is refreshed every SCREEN_FRAME_RATE event loops cycles.
+ * Period of screen updates in milliseconds. This is about the rate at which the main loop used to
+ * render when it was spinning, which the per-frame animations (scrolling labels, blinking cursor)
+ * are tuned to.
  */
-#define SCREEN_FRAME_RATE 30
+#define SCREEN_FRAME_PERIOD_MS 10
+
+/**
+ * Maximum number of frame periods rendering is postponed by `screen_process_defer_frame()`.
+ */
+#define SCREEN_MAX_DEFERRED_FRAMES 5
+
+/**
+ * Starts the frame timer. Until then, the screen is only rendered when the on-screen component
+ * changes.
+ */
+void screen_process_init(void);
+
+/**
+ * Tells `screen_process()` that USB traffic is being handled in the current main loop iteration.
+ * A due frame is then skipped, for up to SCREEN_MAX_DEFERRED_FRAMES frame periods, so that
+ * multi-frame requests and replies are not held up by rendering. Screen changes are still
+ * rendered right away.
+ */
+void screen_process_defer_frame(void);
 
 #endif
@@ -62,6 +62,7 @@
 // limitations under the License.
 
 #include <stdbool.h>
+#include <string.h>
 #include <ui/oled/oled.h>
 #include <util.h>
 #include "ugui.h"
@@ -130,6 +131,16 @@ static void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc,
 
     if (font->font_type == FONT_TYPE_1BPP) {
         index = (bt - font->start_char) * font->char_height * bn;
+        if (gui->blit != NULL && actual_char_width <= 32 && font->char_height <= 32) {
+            const UG_U8 *columns = NULL;
+            if (font->columns != NULL && actual_char_width <= font->columns_width) {
+                columns = &font->columns[(bt - font->start_char) * font->columns_width *
+                                         ((font->char_height + 7) / 8)];
+            }
+            gui->blit(x, y, &font->p[index], columns, actual_char_width, font->char_height, bn,
+                      fc, bc, transparent, inverted);
+            return;
+        }
         for ( j = 0; j < font->char_height; j++ ) {
             xo = inverted ? (x + actual_char_width) : x;
             c = actual_char_width;
@@ -175,8 +186,35 @@ static void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc,
     }
 }
 
+/*
+ * Appends the char at `index` to `layout`, extending the last run if `extend` is true, i.e. if
+ * the char is drawn right after the previous one.
+ */
+static void _UG_LayoutAdd( UG_LAYOUT *layout, bool extend, size_t index, UG_S16 x, UG_S16 y )
+{
+    if (layout->overflow) {
+        return;
+    }
+    if (extend) {
+        layout->lines[layout->num_lines - 1].len++;
+        return;
+    }
+    if (layout->num_lines == UG_LAYOUT_MAX_LINES || index > 0xFFFF) {
+        layout->overflow = true;
+        return;
+    }
+    UG_LAYOUT_LINE *line = &layout->lines[layout->num_lines++];
+    line->x = x;
+    line->y = y;
+    line->start = (UG_U16)index;
+    line->len = 1;
+}
+
+// If `layout` is not NULL, the chars are appended to it instead of being drawn, with their index
+// in `str` offset by `layout_offset`.
 static void _UG_PutString( UG_S16 x, UG_S16 y, UG_S16 *xout, UG_S16 *yout, const char *str,
-                    int autobreak, int calconly, bool inverted )
+                    int autobreak, int calconly, bool inverted, UG_LAYOUT *layout,
+                    size_t layout_offset )
 {
     if (gui == NULL) {
         return;
@@ -192,13 +230,17 @@ static void _UG_PutString( UG_S16 x, UG_S16 y, UG_S16 *xout, UG_S16 *yout, const
 
     const int str_length = strlens(str);
     uint8_t line = 0;
+    // Whether the previous char was appended to `layout`, with nothing skipped since.
+    bool extend = false;
 
     for (int i = 0; i < str_length; i++) {
         chr = (char)(inverted ? str[str_length - 1 - i] : str[i]);
         if (chr != '\n' && (chr < gui->font.start_char || chr > gui->font.end_char)) {
+            extend = false;
             continue;
         }
         if ( chr == '\n' ) {
+            extend = false;
             if (autobreak == 1) {
                 xp = gui->x_dim;
             } else {
@@ -212,12 +254,17 @@ static void _UG_PutString( UG_S16 x, UG_S16 y, UG_S16 *xout, UG_S16 *yout, const
              gui->font.char_width;
 
         if ( autobreak == 1 && xp + cw > gui->x_dim - 1 ) {
+            extend = false;
             line++;
             xp = x;
             yp += gui->font.char_height + gui->char_v_space;
         }
 
-        if (!calconly) {
+        if (layout != NULL) {
+            const int index = inverted ? str_length - 1 - i : i;
+            _UG_LayoutAdd(layout, extend, layout_offset + index, xp, yp);
+            extend = true;
+        } else if (!calconly) {
             UG_PutChar(chr, xp, yp, gui->fore_color, gui->back_color, inverted);
         }
 
@@ -249,11 +296,19 @@ UG_S16 UG_Init( UG_GUI *g, void (*p)(UG_S16, UG_S16, UG_COLOR),
     g->char_v_space = 1;
     g->fore_color = C_WHITE;
     g->back_color = C_BLACK;
+    g->blit = NULL;
 
     gui = g;
     return 1;
 }
 
+void UG_DriverRegisterBlit( UG_BLIT_FUNC blit )
+{
+    if (gui) {
+        gui->blit = blit;
+    }
+}
+
 void UG_FontSelect( const UG_FONT *font )
 {
     if (gui && font) {
@@ -585,7 +640,7 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
 
 void UG_MeasureString(UG_S16 *xout, UG_S16 *yout, const char *str)
 {
-    _UG_PutString(0, 0, xout, yout, str, 1, 1, false);
+    _UG_PutString(0, 0, xout, yout, str, 1, 1, false, NULL, 0);
 }
 
 /**
@@ -594,7 +649,7 @@ void UG_MeasureString(UG_S16 *xout, UG_S16 *yout, const char *str)
  */
 void UG_MeasureStringNoBreak(UG_S16 *xout, UG_S16 *yout, const char *str)
 {
-    _UG_PutString(0, 0, xout, yout, str, 0, 1, false);
+    _UG_PutString(0, 0, xout, yout, str, 0, 1, false, NULL, 0);
 }
 
 /**
@@ -620,7 +675,7 @@ void UG_MeasureStringCentered(UG_S16 *xout, UG_S16 *yout, const char *str)
     for (c = str; *c != '\0'; c++) {
         if (*c == '\n') {
             snprintf(line, sizeof(line), "%.*s", (int)(c - start), start);
-            _UG_PutString(0, 0, &calc_width_line, &calc_height_line, line, 0, 1, false);
+            _UG_PutString(0, 0, &calc_width_line, &calc_height_line, line, 0, 1, false, NULL, 0);
             *yout += calc_height_line;
             *yout += gui->char_v_space;
             *xout = MAX(*xout, calc_width_line);
@@ -628,7 +683,7 @@ void UG_MeasureStringCentered(UG_S16 *xout, UG_S16 *yout, const char *str)
         }
     }
     snprintf(line, sizeof(line), "%.*s", (int)(c - start), start);
-    _UG_PutString(0, 0, &calc_width_line, &calc_height_line, line, 0, 1, false);
+    _UG_PutString(0, 0, &calc_width_line, &calc_height_line, line, 0, 1, false, NULL, 0);
     *yout += calc_height_line;
     *yout += gui->char_v_space;
     *xout = MAX(*xout, calc_width_line);
@@ -717,12 +772,12 @@ void UG_WrapTitleString(const char* str, char* str_out, UG_S16 width) {
 
 void UG_PutString( UG_S16 x, UG_S16 y, const char *str, bool inverted)
 {
-    _UG_PutString(x, y, NULL, NULL, str, 1, 0, inverted);
+    _UG_PutString(x, y, NULL, NULL, str, 1, 0, inverted, NULL, 0);
 }
 
 void UG_PutStringNoBreak( UG_S16 x, UG_S16 y, const char *str, bool inverted)
 {
-    _UG_PutString(x, y, NULL, NULL, str, 0, 0, inverted);
+    _UG_PutString(x, y, NULL, NULL, str, 0, 0, inverted, NULL, 0);
 }
 
 /**
@@ -733,10 +788,8 @@ void UG_PutStringNoBreak( UG_S16 x, UG_S16 y, const char *str, bool inverted)
  *   the overflowing lines on top of each other.
  * Auto-break is disabled with this feature.
  */
-void UG_PutStringCentered( UG_S16 x, UG_S16 y, UG_S16 width, UG_S16 height, const char *str, bool inverted) {
-    if (gui == NULL) {
-        return;
-    }
+static void _UG_PutStringCentered( UG_S16 x, UG_S16 y, UG_S16 width, UG_S16 height,
+                                   const char *str, bool inverted, UG_LAYOUT *layout) {
 
     UG_S16 calc_width;
     if (x == 0 && width == 0) {
@@ -757,24 +810,103 @@ void UG_PutStringCentered( UG_S16 x, UG_S16 y, UG_S16 width, UG_S16 height, cons
     uint8_t current_line = 0;
     const uint8_t max_line = UG_MAX_LINE_COLS;
     char lines[num_lines][max_line];
+    // Offset of each line in `str`, for the layout.
+    size_t line_offsets[num_lines];
+    line_offsets[0] = 0;
     const char* start = str;
     for (c = str; *c != '\0'; c++) {
         if (*c == '\n' && current_line < UG_MAX_LINE_ROWS) {
             snprintf(lines[current_line], sizeof(lines[current_line]), "%.*s", (int)(c - start), start);
             current_line++;
             start = c + 1;
+            line_offsets[current_line] = (size_t)(start - str);
         }
     }
     snprintf(lines[current_line], sizeof(lines[current_line]), "%.*s", (int)(c - start), start);
 
     // calculate the height of each line
-    _UG_PutString(0, 0, NULL, &calc_height, "W", 0, 1, inverted);
+    _UG_PutString(0, 0, NULL, &calc_height, "W", 0, 1, inverted, NULL, 0);
     y = y + (height - ((calc_height + gui->char_v_space) * num_lines)) / 2;
     for (uint16_t i = 0; i < num_lines; i++) {
         UG_S16 current_y = y + (i * (calc_height + gui->char_v_space));
-        _UG_PutString(0, 0, &calc_width, NULL, lines[i], 0, 1, inverted);
+        _UG_PutString(0, 0, &calc_width, NULL, lines[i], 0, 1, inverted, NULL, 0);
         UG_S16 pos_x = x + (width - calc_width) / 2;
-        _UG_PutString(pos_x, current_y, NULL, NULL, lines[i], 0, 0, inverted);
+        _UG_PutString(
+            pos_x, current_y, NULL, NULL, lines[i], 0, 0, inverted, layout, line_offsets[i]);
+    }
+}
+
+void UG_PutStringCentered( UG_S16 x, UG_S16 y, UG_S16 width, UG_S16 height, const char *str, bool inverted) {
+    if (gui == NULL) {
+        return;
+    }
+    _UG_PutStringCentered(x, y, width, height, str, inverted, NULL);
+}
+
+void UG_LayoutString( UG_LAYOUT *layout, const char *str, UG_LAYOUT_MODE mode, UG_S16 x,
+                      UG_S16 width, UG_S16 height, bool inverted )
+{
+    memset(layout, 0, sizeof(*layout));
+    layout->inverted = inverted;
+    layout->mode = (UG_U8)mode;
+    layout->width = width;
+    layout->height = height;
+    if (gui == NULL) {
+        return;
+    }
+    switch (mode) {
+    case UG_LAYOUT_BREAK:
+        _UG_PutString(x, 0, NULL, NULL, str, 1, 1, inverted, layout, 0);
+        // Store the positions relative to the layout origin.
+        for (UG_U8 i = 0; i < layout->num_lines; i++) {
+            layout->lines[i].x -= x;
+        }
+        break;
+    case UG_LAYOUT_NO_BREAK:
+        _UG_PutString(0, 0, NULL, NULL, str, 0, 1, inverted, layout, 0);
+        break;
+    case UG_LAYOUT_CENTERED:
+        _UG_PutStringCentered(0, 0, width, height, str, inverted, layout);
+        break;
+    default:
+        break;
+    }
+}
+
+void UG_PutLayout( const UG_LAYOUT *layout, const char *str, UG_S16 x, UG_S16 y )
+{
+    if (gui == NULL) {
+        return;
+    }
+    if (layout->overflow) {
+        switch (layout->mode) {
+        case UG_LAYOUT_BREAK:
+            UG_PutString(x, y, str, layout->inverted);
+            break;
+        case UG_LAYOUT_NO_BREAK:
+            UG_PutStringNoBreak(x, y, str, layout->inverted);
+            break;
+        case UG_LAYOUT_CENTERED:
+            UG_PutStringCentered(x, y, layout->width, layout->height, str, layout->inverted);
+            break;
+        default:
+            break;
+        }
+        return;
+    }
+    for (UG_U8 i = 0; i < layout->num_lines; i++) {
+        const UG_LAYOUT_LINE *line = &layout->lines[i];
+        UG_S16 xp = x + line->x;
+        for (UG_U16 k = 0; k < line->len; k++) {
+            const char chr = str[layout->inverted ? line->start - k : line->start + k];
+            if (chr < gui->font.start_char || chr > gui->font.end_char) {
+                // Only if the font is not the one the layout was computed with.
+                continue;
+            }
+            UG_PutChar(chr, xp, y + line->y, gui->fore_color, gui->back_color, layout->inverted);
+            xp += (gui->font.widths ? gui->font.widths[chr - gui->font.start_char] :
+                   gui->font.char_width) + gui->char_h_space;
+        }
     }
 }
 
@@ -788,8 +920,8 @@ void UG_PutStringNoBreakCenter( UG_S16 x, UG_S16 y, UG_S16 width, const char *st
     if (x == 0 && width == 0) {
         width = gui->x_dim - 1;
     }
-    _UG_PutString(x, y, &calc_width, NULL, str, 0, 1, inverted);
-    _UG_PutString(x + (width - calc_width) / 2, y, NULL, NULL, str, 0, 0, inverted);
+    _UG_PutString(x, y, &calc_width, NULL, str, 0, 1, inverted, NULL, 0);
+    _UG_PutString(x + (width - calc_width) / 2, y, NULL, NULL, str, 0, 0, inverted, NULL, 0);
 }
 
 void UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, bool inverted )
@@ -65,15 +65,41 @@ typedef struct {
     UG_U16 start_char;
     UG_U16 end_char;
     UG_U8  *widths;
+    /* The glyphs in the frame buffer layout of page addressed controllers, generated by
+     * scripts/font_atlas: `columns_width` columns of ceil(char_height/8) bytes per glyph, top
+     * pixel in the least significant bit. NULL if not available. */
+    const UG_U8 *columns;
+    UG_S16 columns_width;
 } UG_FONT;
 
+/* Initializer of UG_FONT.columns and UG_FONT.columns_width. Column atlases are left out of the
+ * bootloader to save flash. */
+#if defined(BOOTLOADER)
+#define UG_FONT_COLUMNS(columns, width) NULL, 0
+#else
+#define UG_FONT_COLUMNS(columns, width) (const UG_U8 *)(columns), (width)
+#endif
+
 #define UG_FONT_DATA
 
 /* -------------------------------------------------------------------------------- */
 /* -- µGUI CORE STRUCTURE                                                        -- */
 /* -------------------------------------------------------------------------------- */
+
+/*
+ * Optional driver function drawing a FONT_TYPE_1BPP glyph directly into the frame buffer, instead
+ * of calling `pset` for every pixel. `bits` are `height` rows of `stride` bytes, least significant
+ * bit first. `columns` is the same glyph from the font's column atlas (see UG_FONT), or NULL.
+ * `width` and `height` are at most 32. Must draw the same pixels as the `pset` loop in
+ * `_UG_PutGlyph()`, including the mirroring if `inverted` is true.
+ */
+typedef void (*UG_BLIT_FUNC)(UG_S16 x, UG_S16 y, const UG_U8 *bits, const UG_U8 *columns,
+                             UG_S16 width, UG_S16 height, UG_U16 stride, UG_COLOR fc, UG_COLOR bc,
+                             bool transparent, bool inverted);
+
 typedef struct {
     void (*pset)(UG_S16, UG_S16, UG_COLOR);
+    UG_BLIT_FUNC blit;
     UG_S16 x_dim;
     UG_S16 y_dim;
     UG_FONT font;
@@ -83,6 +109,51 @@ typedef struct {
     UG_COLOR back_color;
 } UG_GUI;
 
+/* -------------------------------------------------------------------------------- */
+/* -- µGUI TEXT LAYOUT                                                          -- */
+/* -------------------------------------------------------------------------------- */
+
+/* Max. number of runs in a UG_LAYOUT, see UG_LAYOUT_LINE. */
+#define UG_LAYOUT_MAX_LINES 8
+
+/*
+ * A run of `len` consecutive chars of the string starting at `str[start]`, drawn side by side
+ * from `x`, `y` (relative to the layout origin). If the layout is inverted, the run goes
+ * backwards from `str[start]`.
+ */
+typedef struct {
+    UG_S16 x;
+    UG_S16 y;
+    UG_U16 start;
+    UG_U16 len;
+} UG_LAYOUT_LINE;
+
+/*
+ * The line breaks and line positions of a string, computed once by UG_LayoutString() and drawn by
+ * UG_PutLayout() without measuring the string again. The layout refers to the string by index
+ * only, so the string has to be passed again when drawing, and the font and spacing used for
+ * the layout must be selected again as well. Layouts with more than UG_LAYOUT_MAX_LINES runs
+ * are marked as `overflow` and drawn with UG_PutString*() instead.
+ */
+typedef struct {
+    UG_LAYOUT_LINE lines[UG_LAYOUT_MAX_LINES];
+    UG_U8 num_lines;
+    bool overflow;
+    bool inverted;
+    UG_U8 mode;
+    UG_S16 width;
+    UG_S16 height;
+} UG_LAYOUT;
+
+typedef enum {
+    /* Like UG_PutString(). Line breaks depend on the horizontal position of the string. */
+    UG_LAYOUT_BREAK,
+    /* Like UG_PutStringNoBreak(). */
+    UG_LAYOUT_NO_BREAK,
+    /* Like UG_PutStringCentered(), in a box of the given width and height. */
+    UG_LAYOUT_CENTERED,
+} UG_LAYOUT_MODE;
+
 /* -------------------------------------------------------------------------------- */
 /* -- COLORS                                                                     -- */
 /* -------------------------------------------------------------------------------- */
@@ -105,6 +176,7 @@ typedef struct {
 
 UG_S16 UG_Init( UG_GUI *g, void (*p)(UG_S16, UG_S16, UG_COLOR),
                 const UG_FONT *font, UG_S16 x, UG_S16 y );
+void UG_DriverRegisterBlit( UG_BLIT_FUNC blit );
 void UG_FontSelect( const UG_FONT *font );
 void UG_FillScreen( UG_COLOR c );
 void UG_FillFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c );
@@ -126,6 +198,18 @@ void UG_MeasureStringNoBreak(UG_S16 *xout, UG_S16 *yout, const char *str);
 void UG_MeasureStringCentered( UG_S16 *xout, UG_S16 *yout, const char *str);
 void UG_PutStringNoBreakCenter( UG_S16 x, UG_S16 y, UG_S16 width, const char *str, bool inverted);
 void UG_PutStringCentered( UG_S16 x, UG_S16 y, UG_S16 width, UG_S16 height, const char *str, bool inverted);
+/*
+ * Lays out `str` with the current font and spacing, see UG_LAYOUT_MODE. `x` is the horizontal
+ * position the string will be drawn at, only used for UG_LAYOUT_BREAK. `width` and `height` are
+ * only used for UG_LAYOUT_CENTERED.
+ */
+void UG_LayoutString( UG_LAYOUT *layout, const char *str, UG_LAYOUT_MODE mode, UG_S16 x,
+                      UG_S16 width, UG_S16 height, bool inverted );
+/*
+ * Draws `str` as laid out by UG_LayoutString() with its origin at `x`, `y`. `str`, the font and
+ * the spacing must be the same as when the layout was computed.
+ */
+void UG_PutLayout( const UG_LAYOUT *layout, const char *str, UG_S16 x, UG_S16 y );
 void UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, bool inverted );
 void UG_PutCharTransparent( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, bool inverted );
 void UG_SetForecolor( UG_COLOR c );
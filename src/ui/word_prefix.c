@@ -0,0 +1,81 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "word_prefix.h"
+
+#include <string.h>
+
+// First index in [begin, end) at which `strncmp(word, key, len) > 0`, or `>= 0` if `inclusive` is
+// false. Relies on the list being sorted.
+static size_t _bound(
+    const char* const* wordlist,
+    size_t begin,
+    size_t end,
+    const char* key,
+    size_t len,
+    bool inclusive)
+{
+    while (begin < end) {
+        const size_t mid = begin + (end - begin) / 2;
+        const int cmp = strncmp(wordlist[mid], key, len);
+        if (cmp < 0 || (inclusive && cmp == 0)) {
+            begin = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    return begin;
+}
+
+word_prefix_range_t word_prefix_range(
+    const char* const* wordlist,
+    size_t wordlist_size,
+    const char* prefix,
+    size_t prefix_len)
+{
+    word_prefix_range_t range;
+    range.begin = _bound(wordlist, 0, wordlist_size, prefix, prefix_len, false);
+    range.end = _bound(wordlist, range.begin, wordlist_size, prefix, prefix_len, true);
+    return range;
+}
+
+void word_prefix_next_chars(
+    const char* const* wordlist,
+    word_prefix_range_t range,
+    size_t prefix_len,
+    char* chars_out,
+    size_t chars_out_size)
+{
+    if (chars_out_size == 0) {
+        return;
+    }
+    size_t num_chars = 0;
+    size_t idx = range.begin;
+    // The prefix itself sorts before all its extensions.
+    if (word_prefix_is_word(wordlist, range, prefix_len)) {
+        idx++;
+    }
+    while (idx < range.end && num_chars + 1 < chars_out_size) {
+        const char* word = wordlist[idx];
+        chars_out[num_chars++] = word[prefix_len];
+        // Skip all remaining words continuing with the same letter.
+        idx = _bound(wordlist, idx + 1, range.end, word, prefix_len + 1, true);
+    }
+    chars_out[num_chars] = '\0';
+}
+
+bool word_prefix_is_word(const char* const* wordlist, word_prefix_range_t range, size_t prefix_len)
+{
+    return range.begin < range.end && wordlist[range.begin][prefix_len] == '\0';
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _WORD_PREFIX_H_
+#define _WORD_PREFIX_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Prefix lookups in a lexicographically sorted wordlist, e.g. the BIP39 English wordlist or a
+// subset of it. All words sharing a prefix are adjacent in a sorted list, so the matches are found
+// by binary search instead of scanning the whole list.
+
+/**
+ * Indices [begin, end) of the words of a wordlist which start with a prefix.
+ */
+typedef struct {
+    size_t begin;
+    size_t end;
+} word_prefix_range_t;
+
+/**
+ * @param[in] wordlist sorted list of words.
+ * @param[in] wordlist_size number of words in `wordlist`.
+ * @param[in] prefix the prefix. Does not need to be null terminated.
+ * @param[in] prefix_len length of the prefix.
+ * @return the range of words starting with `prefix`. Empty (begin == end) if there are none.
+ */
+word_prefix_range_t word_prefix_range(
+    const char* const* wordlist,
+    size_t wordlist_size,
+    const char* prefix,
+    size_t prefix_len);
+
+/**
+ * Collects the letters that can follow a prefix, i.e. the distinct characters at position
+ * `prefix_len` of the words in `range`, in sorted order. Looks at one word per distinct letter.
+ * @param[in] wordlist sorted list of words.
+ * @param[in] range range of the words with the prefix, as returned by `word_prefix_range()`.
+ * @param[in] prefix_len length of the prefix.
+ * @param[out] chars_out receives the null terminated letters.
+ * @param[in] chars_out_size size of `chars_out`. Letters that do not fit are dropped.
+ */
+void word_prefix_next_chars(
+    const char* const* wordlist,
+    word_prefix_range_t range,
+    size_t prefix_len,
+    char* chars_out,
+    size_t chars_out_size);
+
+/**
+ * @return true if the word equal to the prefix itself is in `range`.
+ */
+bool word_prefix_is_word(const char* const* wordlist, word_prefix_range_t range, size_t prefix_len);
+
+#endif
@@ -61,10 +61,11 @@ int32_t hid_hww_register_callback(enum hid_trans_type trans_type, FUNC_PTR func)
 void hid_hww_setup(void);
 
 /**
- * Send out data
- * returns true if data sent out, false if busy (need retry)
+ * Starts sending the frames in queue_hww_queue(), unless a write is already in progress. Each
+ * completed write starts the next one from the USB interrupt, so all queued frames go out back to
+ * back. Call this after pushing frames to the queue.
  */
-bool hid_hww_write_poll(const uint8_t* data);
+void hid_hww_write_queued(void);
 
 /**
  * Read data
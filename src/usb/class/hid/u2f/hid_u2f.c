@@ -16,6 +16,8 @@
 #include "usb/usb_processing.h"
 #include "usb_size.h"
 #include "usb_u2f_desc.h"
+#include <hal_atomic.h>
+#include <main_loop_event.h>
 #include <queue.h>
 #include <string.h>
 #include <u2f/u2f_packet.h>
@@ -79,19 +81,32 @@ bool hid_u2f_read(uint8_t* data)
 }
 
 /**
- * Sends the next data, if the USB interface is ready.
+ * Starts sending the frame at the head of the queue, if any. The frame stays in the queue until
+ * the endpoint accepted it, so it is not lost if the interface is not ready yet. The queue slot is
+ * released right away but only reused after the next pull, which happens after this write
+ * completed.
+ * Returns true if a write was started.
  */
-bool hid_u2f_write_poll(const uint8_t* data)
+static bool _write_next(void)
 {
-    ASSERT(data);
-    if (_send_busy) {
+    const uint8_t* data = queue_peek(queue_u2f_queue());
+    if (data == NULL) {
         return false;
     }
-    if (hid_write(&_func_data, data, USB_HID_REPORT_OUT_SIZE) == ERR_NONE) {
-        _send_busy = true;
-        return true;
+    if (hid_write(&_func_data, data, USB_HID_REPORT_OUT_SIZE) != ERR_NONE) {
+        return false;
     }
-    return false;
+    queue_pull(queue_u2f_queue());
+    return true;
+}
+
+void hid_u2f_write_queued(void)
+{
+    CRITICAL_SECTION_ENTER()
+    if (!_send_busy) {
+        _send_busy = _write_next();
+    }
+    CRITICAL_SECTION_LEAVE()
 }
 
 /**
@@ -105,6 +120,7 @@ static uint8_t _rx_cb(const uint8_t ep, const enum usb_xfer_code rc, const uint3
     (void)rc;
     (void)count;
     _has_data = true;
+    main_loop_event_wake();
 
     return ERR_NONE;
 }
@@ -115,7 +131,9 @@ static uint8_t _rx_cb(const uint8_t ep, const enum usb_xfer_code rc, const uint3
  */
 static void _tx_cb(void)
 {
-    _send_busy = false;
+    // Send the queued frames back to back instead of waiting for the main loop.
+    _send_busy = _write_next();
+    main_loop_event_wake();
 }
 
 /**
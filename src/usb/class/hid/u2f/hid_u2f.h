@@ -60,7 +60,13 @@ int32_t hid_u2f_register_callback(enum hid_trans_type trans_type, FUNC_PTR func)
  */
 void hid_u2f_setup(void);
 
-bool hid_u2f_write_poll(const uint8_t* data);
+/**
+ * Starts sending the frames in queue_u2f_queue(), unless a write is already in progress. Each
+ * completed write starts the next one from the USB interrupt, so all queued frames go out back to
+ * back. Call this after pushing frames to the queue.
+ */
+void hid_u2f_write_queued(void);
+
 bool hid_u2f_read(uint8_t* data);
 
 #endif
@@ -29,6 +29,7 @@
 
 #ifndef TESTING
 #include <hal_timer.h>
+#include <main_loop_event.h>
 #include <u2f/u2f_packet.h>
 #include <usb/usb_packet.h>
 extern struct timer_descriptor TIMER_0;
@@ -83,6 +84,7 @@ static void _timeout_cb(const struct timer_task* const timer_task)
 {
     (void)timer_task;
     u2f_packet_timeout_tick();
+    main_loop_event_post(MAIN_LOOP_EVENT_TIMER);
 }
 #endif
 
@@ -60,6 +60,9 @@
 // With a packet size of 64 bytes (max for full-speed devices), this means that
 // the maximum message payload length is 64 - 7 + 128 * (64 - 5) = 7609 bytes.
 #define USB_DATA_MAX_LEN 7609U
+// Number of frames of a message with the maximum payload length: one initialization packet and
+// 128 continuation packets.
+#define USB_DATA_MAX_FRAMES 129U
 
 #define HID_VENDOR_FIRST (FRAME_TYPE_INIT | 0x40) // First vendor defined command
 #define HID_VENDOR_LAST (FRAME_TYPE_INIT | 0x7f) // Last vendor defined command
@@ -25,6 +25,7 @@
 #include <hww.h>
 #ifndef TESTING
 #include <hal_timer.h>
+#include <main_loop_event.h>
 extern struct timer_descriptor TIMER_0;
 #endif
 
@@ -40,7 +41,6 @@ extern struct timer_descriptor TIMER_0;
  * (if the client is closed).
  */
 #define USB_OUTSTANDING_OP_TIMEOUT_MS (500)
-#define USB_TIMER_TICK_PERIOD_MS (100)
 #define USB_OUTSTANDING_OP_TIMEOUT_TICKS (USB_OUTSTANDING_OP_TIMEOUT_MS / USB_TIMER_TICK_PERIOD_MS)
 
 struct usb_processing {
@@ -373,9 +373,8 @@ struct usb_processing* usb_processing_hww(void)
 static void _timer_cb(const struct timer_task* const timer_task)
 {
     (void)timer_task;
-    if (_usb_state.timeout_counter != (uint16_t)-1) {
-        _usb_state.timeout_counter++;
-    }
+    usb_processing_timer_tick();
+    main_loop_event_wake();
 }
 
 static void _register_timer(void)
@@ -431,6 +430,14 @@ void usb_processing_timeout_reset(void)
     _usb_state.timeout_counter = 0;
 }
 
+void usb_processing_timer_tick(void)
+{
+    // Saturates, so a long idle period does not wrap around to a fresh timeout.
+    if (_usb_state.timeout_counter != (uint16_t)-1) {
+        _usb_state.timeout_counter++;
+    }
+}
+
 void usb_processing_unlock(void)
 {
     if (!_usb_state.blocking_ctx) {
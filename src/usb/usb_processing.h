@@ -64,6 +64,9 @@ struct usb_processing* usb_processing_hww(void);
 void usb_processing_init(void);
 
 #if !defined(BOOTLOADER)
+// Period of the timer driving the USB lock watchdog, see `usb_processing_timer_tick()`.
+#define USB_TIMER_TICK_PERIOD_MS (100)
+
 void usb_processing_lock(struct usb_processing* ctx);
 
 /**
@@ -75,6 +78,12 @@ void usb_processing_lock(struct usb_processing* ctx);
  */
 void usb_processing_timeout_reset(void);
 
+/**
+ * Advances the USB lock watchdog by one tick of USB_TIMER_TICK_PERIOD_MS. Called from the timer
+ * interrupt in the firmware, and by the simulator to drive its (possibly fast-forwarded) clock.
+ */
+void usb_processing_timer_tick(void);
+
 void usb_processing_unlock(void);
 #endif
 
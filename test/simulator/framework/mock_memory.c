@@ -32,6 +32,7 @@ void mock_memory_factoryreset(void)
     memset(_memory_shared_data, 0xff, sizeof(_memory_shared_data));
     memset(_memory_app_data, 0xff, sizeof(_memory_app_data));
     memset(_memory_smarteeprom, 0xff, sizeof(_memory_smarteeprom));
+    memory_multisig_index_invalidate();
 }
 
 static uint8_t* _get_memory(uint32_t base)
@@ -48,6 +49,25 @@ static uint8_t* _get_memory(uint32_t base)
     }
 }
 
+uint8_t* mock_memory_region(uint32_t base, size_t* len_out)
+{
+    switch (base) {
+    case FLASH_SHARED_DATA_START:
+        *len_out = sizeof(_memory_shared_data);
+        break;
+    case FLASH_APPDATA_START:
+        *len_out = sizeof(_memory_app_data);
+        break;
+    case FLASH_SMARTEEPROM_START:
+        *len_out = sizeof(_memory_smarteeprom);
+        break;
+    default:
+        *len_out = 0;
+        break;
+    }
+    return _get_memory(base);
+}
+
 bool memory_write_to_address_mock(uint32_t base, uint32_t addr, const uint8_t* chunk)
 {
     if (chunk == NULL) {
@@ -99,3 +99,9 @@ void smarteeprom_bb02_config(void)
         smarteeprom_setup();
     }
 }
+
+uint8_t* smarteeprom_mock_image(size_t* len_out)
+{
+    *len_out = _enabled ? _allocated_space : 0;
+    return _enabled ? (uint8_t*)_mem_image : NULL;
+}
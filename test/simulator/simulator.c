@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "hww.h"
+#include "snapshot.h"
 #include "memory/x1-btc-psbt-firmware_smarteeprom.h"
 #include "usb/usb_packet.h"
 #include "usb/usb_processing.h"
@@ -27,12 +28,15 @@
 #include <unistd.h>
 #include <version.h>
 
+#include <errno.h>
 #include <getopt.h>
 #include <netdb.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdbool.h>
 #include <sys/socket.h>
+#include <time.h>
 
 static const char* _simulator_version = "1.0.0";
 
@@ -44,6 +48,20 @@ int commfd;
 static volatile sig_atomic_t sigint_called = false;
 static int sockfd;
 
+// If true, every client connection is served by a forked copy of the freshly set up device, so
+// any number of isolated devices can be simulated behind one listener.
+static bool _fork_per_client = false;
+
+// Speed of the simulated clock driving the USB watchdog, as a multiple of real time. 0 stops the
+// clock, so outstanding operations never time out.
+static unsigned int _clock_speed = 0;
+static uint64_t _clock_last_ms;
+static uint64_t _clock_virtual_ms;
+
+// Device state to start from, and file to save the device state to whenever a client disconnects.
+static const char* _snapshot_load_path = NULL;
+static const char* _snapshot_save_path = NULL;
+
 int get_usb_message_socket(uint8_t* input)
 {
     return read(commfd, input, USB_HID_REPORT_OUT_SIZE);
@@ -76,6 +94,83 @@ static void _int_handler(int _signum)
     close(sockfd);
 }
 
+static uint64_t _now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+// Advances the USB watchdog by the simulated time passed since the last call.
+static void _clock_advance(void)
+{
+    const uint64_t now = _now_ms();
+    _clock_virtual_ms += (now - _clock_last_ms) * _clock_speed;
+    _clock_last_ms = now;
+    // The watchdog counter saturates at 0xffff ticks, no need to tick more often than that.
+    if (_clock_virtual_ms > 0xffffULL * USB_TIMER_TICK_PERIOD_MS) {
+        _clock_virtual_ms = 0xffffULL * USB_TIMER_TICK_PERIOD_MS;
+    }
+    while (_clock_virtual_ms >= USB_TIMER_TICK_PERIOD_MS) {
+        usb_processing_timer_tick();
+        _clock_virtual_ms -= USB_TIMER_TICK_PERIOD_MS;
+    }
+}
+
+// Serves one client until it disconnects.
+static void _serve_client(void)
+{
+    uint8_t input[BUFFER_SIZE];
+    int temp_len;
+    _clock_last_ms = _now_ms();
+    _clock_virtual_ms = 0;
+    while (1) {
+        // With a running clock, wake up once per simulated watchdog tick so that outstanding
+        // operations also time out while the client is silent.
+        int timeout_ms = -1;
+        if (_clock_speed > 0) {
+            timeout_ms = USB_TIMER_TICK_PERIOD_MS / (int)_clock_speed;
+            if (timeout_ms < 1) {
+                timeout_ms = 1;
+            }
+        }
+        struct pollfd pfd = {.fd = commfd, .events = POLLIN};
+        const int ready = poll(&pfd, 1, timeout_ms);
+        if (ready < 0 && errno != EINTR) {
+            perror("poll");
+            return;
+        }
+        if (_clock_speed > 0) {
+            _clock_advance();
+        }
+        if (ready <= 0) {
+            usb_processing_process(usb_processing_hww());
+            // A timeout can queue a reply, which must go out before the next client message is
+            // read.
+            send_usb_message_socket();
+            continue;
+        }
+        // Simulator polls for USB messages from client and then processes them
+        if (get_usb_message_socket(input) <= 0) {
+            return;
+        }
+        simulate_firmware_execution(input);
+
+        // If the USB message to be sent from firmware is bigger than one packet,
+        // then the simulator sends the message in multiple packets. Packets use
+        // HID format, just like the real USB messages.
+        temp_len = data_len - (USB_HID_REPORT_OUT_SIZE - 7);
+        while (temp_len > 0) {
+            // When USB message processing function is called without a new
+            // input, then it does not consume any packets but it still calls
+            // the send function to send further USB messages
+            usb_processing_process(usb_processing_hww());
+            temp_len -= (USB_HID_REPORT_OUT_SIZE - 5);
+        }
+        send_usb_message_socket();
+    }
+}
+
 int main(int argc, char* argv[])
 {
     signal(SIGINT, _int_handler);
@@ -83,7 +178,13 @@ int main(int argc, char* argv[])
     int portno = 15423;
 
     struct option long_options[] = {
-        {"port", required_argument, 0, 'p'}, {"version", no_argument, 0, 'v'}, {0, 0, 0, 0}};
+        {"port", required_argument, 0, 'p'},
+        {"version", no_argument, 0, 'v'},
+        {"fork", no_argument, 0, 'f'},
+        {"clock-speed", required_argument, 0, 'c'},
+        {"snapshot-load", required_argument, 0, 'l'},
+        {"snapshot-save", required_argument, 0, 's'},
+        {0, 0, 0, 0}};
 
     int opt;
     while ((opt = getopt_long(argc, argv, "", long_options, NULL)) != -1) {
@@ -91,6 +192,18 @@ int main(int argc, char* argv[])
         case 'p':
             portno = atoi(optarg);
             break;
+        case 'f':
+            _fork_per_client = true;
+            break;
+        case 'c':
+            _clock_speed = (unsigned int)atoi(optarg);
+            break;
+        case 'l':
+            _snapshot_load_path = optarg;
+            break;
+        case 's':
+            _snapshot_save_path = optarg;
+            break;
         case 'v':
             printf(
                 "x1-btc-psbt-firmware-multi-%s-simulator%s-linux-amd64\n",
@@ -98,10 +211,22 @@ int main(int argc, char* argv[])
                 _simulator_version);
             return 0;
         default:
-            fprintf(stderr, "Usage: %s --port <port number>\n", argv[0]);
+            fprintf(
+                stderr,
+                "Usage: %s [--port <port number>] [--fork] [--clock-speed <factor>]\n"
+                "          [--snapshot-load <file>] [--snapshot-save <file>]\n"
+                "  --fork: serve each client with its own isolated device\n"
+                "  --clock-speed: run the USB timeout clock at <factor> times real time\n"
+                "  --snapshot-load: start with the device state saved in <file>\n"
+                "  --snapshot-save: save the device state to <file> when a client disconnects\n",
+                argv[0]);
             return 1;
         }
     }
+    if (_fork_per_client && _snapshot_save_path != NULL) {
+        fprintf(stderr, "--snapshot-save cannot be combined with --fork\n");
+        return 1;
+    }
 
     // X1-BTC-PSBT-Firmware simulation initialization
     usb_processing_init();
@@ -110,11 +235,14 @@ int main(int argc, char* argv[])
     hww_setup();
     printf("HWW setup success\n");
 
-    bool sd_success = sd_format();
-    printf("Sd card setup %s\n", sd_success ? "success" : "failed");
-    if (!sd_success) {
-        perror("ERROR, sd card setup failed");
-        return 1;
+    // A snapshot brings its own formatted SD card.
+    if (_snapshot_load_path == NULL) {
+        bool sd_success = sd_format();
+        printf("Sd card setup %s\n", sd_success ? "success" : "failed");
+        if (!sd_success) {
+            perror("ERROR, sd card setup failed");
+            return 1;
+        }
     }
 
     mock_memory_factoryreset();
@@ -131,6 +259,15 @@ int main(int argc, char* argv[])
     smarteeprom_bb02_config();
     x1-btc-psbt-firmware_smarteeprom_init();
 
+    if (_snapshot_load_path != NULL) {
+        bool snapshot_success = snapshot_load(_snapshot_load_path);
+        printf("Snapshot load %s\n", snapshot_success ? "success" : "failed");
+        if (!snapshot_success) {
+            fprintf(stderr, "ERROR, could not load snapshot %s\n", _snapshot_load_path);
+            return 1;
+        }
+    }
+
     // Establish socket connection with client
     sockfd = socket(AF_INET, SOCK_STREAM, 0);
     if (sockfd < 0) {
@@ -146,12 +283,17 @@ int main(int argc, char* argv[])
         perror("ERROR binding socket");
         return 1;
     }
-    if (listen(sockfd, 50) < 0) {
+    if (listen(sockfd, SOMAXCONN) < 0) {
         perror("ERROR listening on socket");
         return 1;
     }
 
     printf("Listening on port %d\n", portno);
+    if (_fork_per_client) {
+        // Forked devices are reaped automatically.
+        signal(SIGCHLD, SIG_IGN);
+        printf("Serving each client with a separate device\n");
+    }
 
     while (1) {
         if ((commfd = accept(sockfd, (struct sockaddr*)&serv_addr, (socklen_t*)&serv_addr_len)) <
@@ -164,29 +306,34 @@ int main(int argc, char* argv[])
         }
         printf("Socket connection setup success\n");
 
-        // X1-BTC-PSBT-Firmware firmware loop
-        uint8_t input[BUFFER_SIZE];
-        int temp_len;
-        while (1) {
-            // Simulator polls for USB messages from client and then processes them
-            if (!get_usb_message_socket(input)) break;
-            simulate_firmware_execution(input);
-
-            // If the USB message to be sent from firmware is bigger than one packet,
-            // then the simulator sends the message in multiple packets. Packets use
-            // HID format, just like the real USB messages.
-            temp_len = data_len - (USB_HID_REPORT_OUT_SIZE - 7);
-            while (temp_len > 0) {
-                // When USB message processing function is called without a new
-                // input, then it does not consume any packets but it still calls
-                // the send function to send further USB messages
-                usb_processing_process(usb_processing_hww());
-                temp_len -= (USB_HID_REPORT_OUT_SIZE - 5);
+        if (_fork_per_client) {
+            // Don't let the child inherit unflushed output.
+            fflush(stdout);
+            const pid_t pid = fork();
+            if (pid < 0) {
+                perror("fork");
+                return 1;
             }
-            send_usb_message_socket();
+            if (pid > 0) {
+                // The child owns the connection now.
+                close(commfd);
+                continue;
+            }
+            signal(SIGINT, SIG_DFL);
+            close(sockfd);
+            _serve_client();
+            close(commfd);
+            exit(0);
         }
+
+        // X1-BTC-PSBT-Firmware firmware loop
+        _serve_client();
         close(commfd);
         printf("Socket connection closed\n");
+        if (_snapshot_save_path != NULL) {
+            bool snapshot_success = snapshot_save(_snapshot_save_path);
+            printf("Snapshot save %s\n", snapshot_success ? "success" : "failed");
+        }
         printf("Waiting for new clients, CTRL+C to shut down the simulator\n");
     }
     return 0;
@@ -0,0 +1,211 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "snapshot.h"
+
+#include <keystore.h>
+#include <memory/memory.h>
+#include <memory/smarteeprom.h>
+#include <mock_memory.h>
+#include <util.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Must be included before diskio.h, see http://elm-chan.org/fsw/ff/bd/?show=3626
+#include <ff.h>
+
+#include <diskio.h>
+
+// File format: the magic and version, followed by sections of (tag, length, data), terminated by
+// a section with the tag SECTION_END. Integers are stored in host byte order; snapshots are not
+// meant to be moved between machines.
+static const char _magic[8] = "SIMSNAP";
+#define SNAPSHOT_VERSION 1
+
+typedef enum {
+    SECTION_END = 0,
+    SECTION_FLASH_SHARED_DATA = 1,
+    SECTION_FLASH_APPDATA = 2,
+    SECTION_FLASH_SMARTEEPROM = 3,
+    SECTION_SMARTEEPROM = 4,
+    SECTION_KEYSTORE = 5,
+    // One per used sector: the sector number (uint32_t), followed by the sector contents.
+    SECTION_SD_SECTOR = 6,
+} section_tag_t;
+
+static bool _write_section(FILE* f, section_tag_t tag, const void* data, uint32_t len)
+{
+    const uint32_t header[2] = {tag, len};
+    return fwrite(header, sizeof(header), 1, f) == 1 &&
+           (len == 0 || fwrite(data, len, 1, f) == 1);
+}
+
+// The mocked disk reports the sector size as an `LBA_t`.
+static bool _sd_sector_size(LBA_t* size_out)
+{
+    *size_out = 0;
+    return disk_ioctl(0, GET_SECTOR_SIZE, size_out) == RES_OK && *size_out <= FF_MAX_SS;
+}
+
+static bool _sd_sector_count(LBA_t* count_out)
+{
+    return disk_ioctl(0, GET_SECTOR_COUNT, count_out) == RES_OK;
+}
+
+static bool _save_sd(FILE* f)
+{
+    LBA_t sector_count;
+    LBA_t sector_size;
+    if (!_sd_sector_count(&sector_count) || !_sd_sector_size(&sector_size)) {
+        return false;
+    }
+    uint8_t entry[sizeof(uint32_t) + FF_MAX_SS];
+    static const uint8_t zeros[FF_MAX_SS] = {0};
+    for (LBA_t sector = 0; sector < sector_count; sector++) {
+        uint8_t* contents = entry + sizeof(uint32_t);
+        if (disk_read(0, contents, sector, 1) != RES_OK) {
+            return false;
+        }
+        // The mocked card starts out zeroed, so only sectors that were written to are stored.
+        if (!memcmp(contents, zeros, sector_size)) {
+            continue;
+        }
+        const uint32_t sector_num = (uint32_t)sector;
+        memcpy(entry, &sector_num, sizeof(sector_num));
+        if (!_write_section(
+                f, SECTION_SD_SECTOR, entry, (uint32_t)(sizeof(sector_num) + sector_size))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool snapshot_save(const char* path)
+{
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        return false;
+    }
+    const uint32_t version = SNAPSHOT_VERSION;
+    bool ok = fwrite(_magic, sizeof(_magic), 1, f) == 1 &&
+              fwrite(&version, sizeof(version), 1, f) == 1;
+
+    static const struct {
+        section_tag_t tag;
+        uint32_t base;
+    } regions[] = {
+        {SECTION_FLASH_SHARED_DATA, FLASH_SHARED_DATA_START},
+        {SECTION_FLASH_APPDATA, FLASH_APPDATA_START},
+        {SECTION_FLASH_SMARTEEPROM, FLASH_SMARTEEPROM_START},
+    };
+    for (size_t i = 0; ok && i < sizeof(regions) / sizeof(regions[0]); i++) {
+        size_t len;
+        const uint8_t* data = mock_memory_region(regions[i].base, &len);
+        ok = _write_section(f, regions[i].tag, data, (uint32_t)len);
+    }
+
+    size_t smarteeprom_len;
+    const uint8_t* smarteeprom = smarteeprom_mock_image(&smarteeprom_len);
+    ok = ok && _write_section(f, SECTION_SMARTEEPROM, smarteeprom, (uint32_t)smarteeprom_len);
+
+    keystore_test_state_t keystore_state;
+    keystore_test_get_state(&keystore_state);
+    ok = ok && _write_section(f, SECTION_KEYSTORE, &keystore_state, sizeof(keystore_state));
+    util_zero(&keystore_state, sizeof(keystore_state));
+
+    ok = ok && _save_sd(f) && _write_section(f, SECTION_END, NULL, 0);
+
+    return fclose(f) == 0 && ok;
+}
+
+// Reads exactly `len` bytes into `out`. Fails if the section has a different length.
+static bool _read_exact(FILE* f, uint32_t section_len, void* out, size_t len)
+{
+    return section_len == len && (len == 0 || fread(out, len, 1, f) == 1);
+}
+
+static bool _load_flash_region(FILE* f, uint32_t base, uint32_t len)
+{
+    size_t region_len;
+    uint8_t* region = mock_memory_region(base, &region_len);
+    return region != NULL && _read_exact(f, len, region, region_len);
+}
+
+static bool _load_section(FILE* f, uint32_t tag, uint32_t len)
+{
+    switch (tag) {
+    case SECTION_FLASH_SHARED_DATA:
+        return _load_flash_region(f, FLASH_SHARED_DATA_START, len);
+    case SECTION_FLASH_APPDATA:
+        return _load_flash_region(f, FLASH_APPDATA_START, len);
+    case SECTION_FLASH_SMARTEEPROM:
+        return _load_flash_region(f, FLASH_SMARTEEPROM_START, len);
+    case SECTION_SMARTEEPROM: {
+        size_t image_len;
+        uint8_t* image = smarteeprom_mock_image(&image_len);
+        return image != NULL && _read_exact(f, len, image, image_len);
+    }
+    case SECTION_KEYSTORE: {
+        keystore_test_state_t keystore_state;
+        if (!_read_exact(f, len, &keystore_state, sizeof(keystore_state))) {
+            return false;
+        }
+        keystore_test_set_state(&keystore_state);
+        util_zero(&keystore_state, sizeof(keystore_state));
+        return true;
+    }
+    case SECTION_SD_SECTOR: {
+        LBA_t sector_count;
+        LBA_t sector_size;
+        uint32_t sector_num;
+        uint8_t contents[FF_MAX_SS];
+        return _sd_sector_count(&sector_count) && _sd_sector_size(&sector_size) &&
+               len == sizeof(sector_num) + sector_size &&
+               fread(&sector_num, sizeof(sector_num), 1, f) == 1 && sector_num < sector_count &&
+               fread(contents, sector_size, 1, f) == 1 &&
+               disk_write(0, contents, sector_num, 1) == RES_OK;
+    }
+    default:
+        return false;
+    }
+}
+
+bool snapshot_load(const char* path)
+{
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+    char magic[sizeof(_magic)];
+    uint32_t version;
+    bool ok = fread(magic, sizeof(magic), 1, f) == 1 && !memcmp(magic, _magic, sizeof(magic)) &&
+              fread(&version, sizeof(version), 1, f) == 1 && version == SNAPSHOT_VERSION;
+    while (ok) {
+        uint32_t header[2];
+        if (fread(header, sizeof(header), 1, f) != 1) {
+            ok = false;
+            break;
+        }
+        if (header[0] == SECTION_END) {
+            break;
+        }
+        ok = _load_section(f, header[0], header[1]);
+    }
+    fclose(f);
+    // The flash contents were replaced behind memory.c's back.
+    memory_multisig_index_invalidate();
+    return ok;
+}
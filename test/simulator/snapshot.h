@@ -0,0 +1,40 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _SIMULATOR_SNAPSHOT_H_
+#define _SIMULATOR_SNAPSHOT_H_
+
+#include <stdbool.h>
+
+/**
+ * Saves the complete state of the simulated device to a file: the mocked flash regions, the
+ * SmartEEPROM, the used sectors of the SD card and the keystore RAM state (unlocked, retained
+ * seeds). A seeded and unlocked device stays unlocked when the snapshot is loaded again.
+ *
+ * @param[in] path file to write to. An existing file is replaced.
+ * @return true on success.
+ */
+bool snapshot_save(const char* path);
+
+/**
+ * Restores a device state saved by `snapshot_save()`. Must be called after the simulated device
+ * was set up (memory, SmartEEPROM), before serving clients. The SD card is expected to be blank,
+ * i.e. not formatted, as only the used sectors are stored.
+ *
+ * @param[in] path file to read from.
+ * @return true on success. On failure, the device state is undefined.
+ */
+bool snapshot_load(const char* path);
+
+#endif
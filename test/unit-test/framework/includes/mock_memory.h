@@ -16,6 +16,7 @@
 #define _MOCK_MEMORY_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include <flags.h>
@@ -29,4 +30,10 @@ void memory_read_shared_bootdata_mock(uint8_t* chunk_out);
 void mock_memory_set_salt_root(const uint8_t* salt_root);
 void memory_bootloader_hash_mock(uint8_t* hash_out);
 void memory_set_bootloader_hash_mock(const uint8_t* mock_hash);
+// Raw contents of the mocked flash region starting at `base` (e.g. `FLASH_APPDATA_START`), or
+// NULL for an unknown region. Simulator only.
+uint8_t* mock_memory_region(uint32_t base, size_t* len_out);
+// Defined in memory.c. Drops the RAM index of multisig registrations, needed after the mocked
+// flash was wiped behind memory.c's back.
+void memory_multisig_index_invalidate(void);
 #endif
@@ -33,6 +33,7 @@ void mock_memory_factoryreset(void)
     memset(_memory_shared_data, 0xff, sizeof(_memory_shared_data));
     memset(_memory_app_data, 0xff, sizeof(_memory_app_data));
     memset(_memory_smarteeprom, 0xff, sizeof(_memory_smarteeprom));
+    memory_multisig_index_invalidate();
 }
 
 static uint8_t* _get_memory(uint32_t base)
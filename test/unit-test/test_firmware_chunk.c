@@ -0,0 +1,119 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+
+#include <bootloader/firmware_chunk.h>
+
+#include <stdint.h>
+#include <string.h>
+
+static uint8_t _installed[2 * FIRMWARE_CHUNK_LEN];
+
+static const uint8_t* _installed_fn(uint32_t offset, uint32_t len)
+{
+    if (offset > sizeof(_installed) || len > sizeof(_installed) - offset) {
+        return NULL;
+    }
+    return &_installed[offset];
+}
+
+static size_t _op(uint8_t* out, uint8_t op, uint16_t len)
+{
+    out[0] = op;
+    out[1] = len & 0xff;
+    out[2] = len >> 8;
+    return 3;
+}
+
+static void _test_firmware_chunk_decode(void** state)
+{
+    for (size_t i = 0; i < sizeof(_installed); i++) {
+        _installed[i] = (uint8_t)(i * 7);
+    }
+    static uint8_t in[FIRMWARE_CHUNK_LEN];
+    size_t in_len = 0;
+    // 4 literal bytes, repeated by a match overlapping its own output, 100 times 0xff, and the
+    // rest taken from the second chunk of the installed firmware.
+    in_len += _op(&in[in_len], FIRMWARE_CHUNK_OP_LITERAL, 4);
+    memcpy(&in[in_len], "\x01\x02\x03\x04", 4);
+    in_len += 4;
+    in_len += _op(&in[in_len], FIRMWARE_CHUNK_OP_MATCH, 10);
+    in[in_len++] = 4;
+    in[in_len++] = 0;
+    in_len += _op(&in[in_len], FIRMWARE_CHUNK_OP_FILL, 100);
+    in[in_len++] = 0xff;
+    const uint16_t rest = FIRMWARE_CHUNK_LEN - 114;
+    in_len += _op(&in[in_len], FIRMWARE_CHUNK_OP_INSTALLED, rest);
+    const uint32_t offset = FIRMWARE_CHUNK_LEN + 1;
+    memcpy(&in[in_len], (const uint8_t[]){offset & 0xff, (offset >> 8) & 0xff, offset >> 16, 0}, 4);
+    in_len += 4;
+
+    static uint8_t out[FIRMWARE_CHUNK_LEN];
+    assert_true(firmware_chunk_decode(in, in_len, _installed_fn, out));
+    assert_memory_equal(out, "\x01\x02\x03\x04\x01\x02\x03\x04\x01\x02\x03\x04\x01\x02", 14);
+    for (size_t i = 14; i < 114; i++) {
+        assert_int_equal(out[i], 0xff);
+    }
+    assert_memory_equal(&out[114], &_installed[offset], rest);
+
+    // Truncated input.
+    assert_false(firmware_chunk_decode(in, in_len - 1, _installed_fn, out));
+    // Output too short.
+    assert_false(firmware_chunk_decode(in, in_len - 7, _installed_fn, out));
+}
+
+static void _test_firmware_chunk_decode_invalid(void** state)
+{
+    static uint8_t out[FIRMWARE_CHUNK_LEN];
+    uint8_t in[16];
+    size_t in_len;
+
+    // Match reaching before the start of the chunk.
+    in_len = _op(in, FIRMWARE_CHUNK_OP_FILL, 2);
+    in[in_len++] = 0;
+    in_len += _op(&in[in_len], FIRMWARE_CHUNK_OP_MATCH, 1);
+    in[in_len++] = 3;
+    in[in_len++] = 0;
+    assert_false(firmware_chunk_decode(in, in_len, _installed_fn, out));
+
+    // Output exceeding the chunk length.
+    in_len = _op(in, FIRMWARE_CHUNK_OP_FILL, FIRMWARE_CHUNK_LEN);
+    in[in_len++] = 0;
+    in_len += _op(&in[in_len], FIRMWARE_CHUNK_OP_FILL, 1);
+    in[in_len++] = 0;
+    assert_false(firmware_chunk_decode(in, in_len, _installed_fn, out));
+
+    // Installed firmware not available.
+    in_len = _op(in, FIRMWARE_CHUNK_OP_INSTALLED, FIRMWARE_CHUNK_LEN);
+    memcpy(&in[in_len], (const uint8_t[]){0, 0x20, 0, 0}, 4);
+    in_len += 4;
+    assert_false(firmware_chunk_decode(in, in_len, _installed_fn, out));
+
+    // Unknown op.
+    in_len = _op(in, 0x04, FIRMWARE_CHUNK_LEN);
+    assert_false(firmware_chunk_decode(in, in_len, _installed_fn, out));
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(_test_firmware_chunk_decode),
+        cmocka_unit_test(_test_firmware_chunk_decode_invalid),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
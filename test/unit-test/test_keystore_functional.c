@@ -168,7 +168,27 @@ static void _test_combination(
     uint8_t u2f_seed[32];
     assert_true(keystore_get_u2f_seed(u2f_seed));
     _assert_equal_memory_hex(u2f_seed, sizeof(u2f_seed), expected_u2f_seed_hex);
+
+    // The retained U2F HMAC context matches a HMAC keyed with the U2F seed, also when reused.
+    const uint8_t msgs[2][64] = {{0x01}, {0x02}};
+    for (size_t i = 0; i < 2; i++) {
+        uint8_t mac[HMAC_SHA256_LEN];
+        uint8_t expected_mac[HMAC_SHA256_LEN];
+        assert_true(keystore_u2f_hmac(msgs[i], sizeof(msgs[i]), mac));
+        assert_int_equal(
+            WALLY_OK,
+            wally_hmac_sha256(
+                u2f_seed,
+                sizeof(u2f_seed),
+                msgs[i],
+                sizeof(msgs[i]),
+                expected_mac,
+                sizeof(expected_mac)));
+        assert_memory_equal(mac, expected_mac, sizeof(mac));
+    }
     keystore_lock();
+    uint8_t mac[HMAC_SHA256_LEN];
+    assert_false(keystore_u2f_hmac(msgs[0], sizeof(msgs[0]), mac));
 }
 
 static void _test_fixtures(void** state)
@@ -70,6 +70,30 @@ static void _test_memory_multisig(void** state)
     assert_string_equal(name, name0_renamed);
 }
 
+// The registrations are served from a RAM index; it must follow a reset of the hww memory.
+static void _test_memory_multisig_reset(void** state)
+{
+    mock_memory_factoryreset();
+
+    memory_interface_functions_t ifs = {
+        .random_32_bytes = random_32_bytes_mcu,
+    };
+    assert_true(memory_setup(&ifs));
+
+    const uint8_t hash[32] = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa";
+    char name[31] = {0};
+    assert_int_equal(MEMORY_OK, memory_multisig_set_by_hash(hash, "name"));
+    assert_true(memory_multisig_get_by_hash(hash, name));
+    assert_string_equal(name, "name");
+
+    assert_true(memory_reset_hww());
+    assert_false(memory_multisig_get_by_hash(hash, name));
+    // The name is free again after the reset.
+    const uint8_t hash2[32] = "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb";
+    assert_int_equal(MEMORY_OK, memory_multisig_set_by_hash(hash2, "name"));
+    assert_true(memory_multisig_get_by_hash(hash2, NULL));
+}
+
 static void _test_memory_multisig_invalid(void** state)
 {
     // invalid hash
@@ -262,6 +286,7 @@ int main(void)
 {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(_test_memory_multisig),
+        cmocka_unit_test(_test_memory_multisig_reset),
         cmocka_unit_test(_test_memory_multisig_invalid),
         cmocka_unit_test(_test_memory_multisig_full),
         cmocka_unit_test(_test_memory_attestation),
@@ -0,0 +1,181 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+
+#include <string.h>
+#include <ui/fonts/arial_fonts.h>
+#include <ui/fonts/monogram_5X9.h>
+#include <ui/fonts/password_11X12.h>
+#include <ui/fonts/password_9X9.h>
+#include <ui/ugui/ugui.h>
+
+// Both drivers keep their frame buffer pointer in a static variable of the same name.
+#define _frame_buffer _sh1107_frame_buffer
+#include "ui/oled/sh1107.c"
+#undef _frame_buffer
+#define _frame_buffer _ssd1312_frame_buffer
+#include "ui/oled/ssd1312.c"
+#undef _frame_buffer
+
+void oled_writer_write_data(const uint8_t* buf, size_t buf_len) {}
+void oled_writer_write_cmd(uint8_t command) {}
+void oled_writer_write_cmd_with_param(uint8_t command, uint8_t value) {}
+
+typedef struct {
+    void (*configure)(uint8_t*);
+    void (*set_pixel)(uint16_t x, uint16_t y, uint8_t c);
+    UG_BLIT_FUNC blit;
+} display_t;
+
+static const display_t _displays[] = {
+    {sh1107_configure, sh1107_set_pixel, sh1107_blit},
+    {ssd1312_configure, ssd1312_set_pixel, ssd1312_blit},
+};
+
+// Fonts with a column atlas, see ATLAS_FONTS in scripts/font_atlas.
+static const UG_FONT* _atlas_fonts[] = {
+    &font_font_a_9X9,
+    &font_font_a_11X10,
+    &font_password_9X9,
+    &font_password_11X12,
+};
+
+// Same as font_font_a_11X10, but without column atlas.
+static UG_FONT _font_without_columns;
+
+// font_font_a_17X18 and font_monogram_5X9 have no column atlas.
+static const UG_FONT* _fonts[] = {
+    &font_font_a_9X9,
+    &font_font_a_11X10,
+    &font_font_a_17X18,
+    &font_monogram_5X9,
+    &_font_without_columns,
+};
+
+static UG_GUI _gui;
+
+// Draws a glyph with and without the blit function and checks that the same pixels are set.
+static void _check_glyph(
+    const display_t* display,
+    char chr,
+    UG_S16 x,
+    UG_S16 y,
+    UG_COLOR fc,
+    UG_COLOR bc,
+    bool transparent,
+    bool inverted)
+{
+    uint8_t expected[128 * 8];
+    uint8_t buf[128 * 8];
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        buf[i] = (uint8_t)(i * 37);
+    }
+    memcpy(expected, buf, sizeof(buf));
+
+    display->configure(expected);
+    UG_DriverRegisterBlit(NULL);
+    if (transparent) {
+        UG_PutCharTransparent(chr, x, y, fc, inverted);
+    } else {
+        UG_PutChar(chr, x, y, fc, bc, inverted);
+    }
+
+    display->configure(buf);
+    UG_DriverRegisterBlit(display->blit);
+    if (transparent) {
+        UG_PutCharTransparent(chr, x, y, fc, inverted);
+    } else {
+        UG_PutChar(chr, x, y, fc, bc, inverted);
+    }
+    assert_memory_equal(buf, expected, sizeof(buf));
+}
+
+// The column atlases must match the glyph bitmaps. Run scripts/font_atlas if they do not.
+static void _test_font_columns(void** state)
+{
+    (void)state;
+    for (size_t f = 0; f < sizeof(_atlas_fonts) / sizeof(*_atlas_fonts); f++) {
+        const UG_FONT* font = _atlas_fonts[f];
+        assert_non_null(font->columns);
+        const int row_len = (font->char_width + 7) / 8;
+        const int pages = (font->char_height + 7) / 8;
+        for (int chr = 0; chr <= font->end_char - font->start_char; chr++) {
+            assert_true(font->widths[chr] <= font->columns_width);
+            const uint8_t* rows = &font->p[chr * font->char_height * row_len];
+            const uint8_t* columns = &font->columns[chr * font->columns_width * pages];
+            for (int x = 0; x < font->columns_width; x++) {
+                for (int y = 0; y < font->char_height; y++) {
+                    assert_int_equal(
+                        (rows[y * row_len + x / 8] >> (x % 8)) & 1,
+                        (columns[x * pages + y / 8] >> (y % 8)) & 1);
+                }
+            }
+        }
+    }
+}
+
+static void _test_oled_blit(void** state)
+{
+    (void)state;
+    _font_without_columns = font_font_a_11X10;
+    _font_without_columns.columns = NULL;
+    const UG_S16 xs[] = {-7, 0, 3, 61, 120, 127};
+    const UG_S16 ys[] = {-5, 0, 6, 50, 60};
+    const char chars[] = {' ', '!', '0', 'A', 'M', 'W', 'g', 'q', '~'};
+    for (size_t d = 0; d < sizeof(_displays) / sizeof(*_displays); d++) {
+        const display_t* display = &_displays[d];
+        UG_Init(
+            &_gui,
+            (void (*)(UG_S16, UG_S16, UG_COLOR))display->set_pixel,
+            &font_font_a_11X10,
+            128,
+            64);
+        for (size_t f = 0; f < sizeof(_fonts) / sizeof(*_fonts); f++) {
+            UG_FontSelect(_fonts[f]);
+            for (size_t c = 0; c < sizeof(chars); c++) {
+                for (size_t xi = 0; xi < sizeof(xs) / sizeof(*xs); xi++) {
+                    for (size_t yi = 0; yi < sizeof(ys) / sizeof(*ys); yi++) {
+                        for (int flags = 0; flags < 8; flags++) {
+                            const bool transparent = flags & 1;
+                            const bool inverted = flags & 2;
+                            const bool black_on_white = flags & 4;
+                            _check_glyph(
+                                display,
+                                chars[c],
+                                xs[xi],
+                                ys[yi],
+                                black_on_white ? C_BLACK : C_WHITE,
+                                black_on_white ? C_WHITE : C_BLACK,
+                                transparent,
+                                inverted);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(_test_font_columns),
+        cmocka_unit_test(_test_oled_blit),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,97 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+
+#include <p256.h>
+#include <wally_crypto.h>
+
+#include <stdint.h>
+#include <string.h>
+
+static const uint8_t _privkey[P256_PRIVKEY_LEN] = {
+    0x50, 0x3e, 0x32, 0xee, 0xb9, 0xca, 0xb8, 0x67, 0x3f, 0x78, 0x47,
+    0xc0, 0x47, 0xfa, 0x57, 0xad, 0x2b, 0xe0, 0x48, 0x5d, 0x07, 0x59,
+    0x94, 0x84, 0x13, 0xcc, 0x8c, 0x00, 0x2b, 0x52, 0x9f, 0xe4,
+};
+
+static void _test_p256_pubkey(void** state)
+{
+    const uint8_t expected_pubkey[P256_PUBKEY_LEN] = {
+        0x84, 0xc2, 0x3f, 0x7b, 0x11, 0xa2, 0x94, 0x87, 0x84, 0xe3, 0x9d,
+        0x85, 0xd2, 0x9c, 0x92, 0xea, 0xef, 0x97, 0x92, 0x5b, 0xfb, 0xf6,
+        0xa5, 0xf5, 0xae, 0xc0, 0xe1, 0x06, 0x01, 0x10, 0x34, 0x69, 0x5e,
+        0x1e, 0x43, 0x9a, 0x99, 0xc7, 0x0e, 0x6a, 0x69, 0x13, 0x20, 0x6d,
+        0xea, 0xc5, 0x89, 0x40, 0x31, 0xba, 0x0c, 0x4f, 0xcb, 0xb7, 0xba,
+        0x34, 0x56, 0xf5, 0x29, 0x58, 0xf3, 0x0e, 0x27, 0xc3,
+    };
+    uint8_t pubkey[P256_PUBKEY_LEN];
+    p256_pubkey(_privkey, pubkey);
+    assert_memory_equal(pubkey, expected_pubkey, sizeof(pubkey));
+}
+
+static void _test_p256_sign_verify(void** state)
+{
+    uint8_t hash[SHA256_LEN];
+    assert_int_equal(WALLY_OK, wally_sha256((const uint8_t*)"msg", 3, hash, sizeof(hash)));
+
+    // Deterministic signature (RFC6979).
+    const uint8_t expected_sig[P256_SIG_LEN] = {
+        0x5a, 0x1f, 0x4c, 0x00, 0xa5, 0x10, 0x4e, 0xdd, 0x39, 0xfc, 0x8f,
+        0x55, 0x86, 0x3b, 0x04, 0xa8, 0x2c, 0x66, 0x2c, 0x56, 0x44, 0x8a,
+        0x10, 0xc3, 0xa3, 0x5f, 0xd4, 0xd0, 0xde, 0xcb, 0x9d, 0x8a, 0x82,
+        0x40, 0xcb, 0xcd, 0xd2, 0x51, 0xc6, 0xd7, 0x6d, 0x78, 0x98, 0x1b,
+        0x14, 0x09, 0x2c, 0x01, 0x46, 0x6c, 0x90, 0xad, 0x7e, 0x1c, 0x69,
+        0x9f, 0x2c, 0x5e, 0x11, 0x52, 0x3e, 0xc6, 0xdf, 0x8c,
+    };
+    uint8_t sig[P256_SIG_LEN];
+    p256_sign(_privkey, hash, sig);
+    assert_memory_equal(sig, expected_sig, sizeof(sig));
+
+    uint8_t pubkey[P256_PUBKEY_LEN];
+    p256_pubkey(_privkey, pubkey);
+    assert_true(p256_verify(pubkey, hash, sig));
+
+    // Wrong message.
+    uint8_t other_hash[SHA256_LEN];
+    memcpy(other_hash, hash, sizeof(hash));
+    other_hash[0] ^= 1;
+    assert_false(p256_verify(pubkey, other_hash, sig));
+
+    // Tampered signature.
+    sig[P256_SIG_LEN - 1] ^= 1;
+    assert_false(p256_verify(pubkey, hash, sig));
+    sig[P256_SIG_LEN - 1] ^= 1;
+
+    // Wrong public key.
+    uint8_t other_privkey[P256_PRIVKEY_LEN];
+    memcpy(other_privkey, _privkey, sizeof(other_privkey));
+    other_privkey[0] ^= 1;
+    uint8_t other_pubkey[P256_PUBKEY_LEN];
+    p256_pubkey(other_privkey, other_pubkey);
+    assert_false(p256_verify(other_pubkey, hash, sig));
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(_test_p256_pubkey),
+        cmocka_unit_test(_test_p256_sign_verify),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,72 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+
+#include <queue.h>
+#include <usb/usb_frame.h>
+
+#include <stdint.h>
+#include <string.h>
+
+static void _test_queue_max_size_reply(void** state)
+{
+    struct queue* queue = queue_hww_queue();
+    queue_init(queue, USB_REPORT_SIZE);
+
+    static uint8_t data[USB_DATA_MAX_LEN];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)i;
+    }
+    const uint32_t cid = 0x12345678;
+    // All frames of a maximum size reply can be queued at once.
+    assert_int_equal(usb_frame_reply(FRAME_MSG, data, sizeof(data), cid, queue), QUEUE_ERR_NONE);
+    // The queue is full now.
+    assert_int_equal(usb_frame_prepare_err(FRAME_ERR_OTHER, cid, queue), QUEUE_ERR_FULL);
+
+    // The frames come out in order and reassemble to the original message.
+    const USB_FRAME* frame = (const USB_FRAME*)queue_pull(queue);
+    assert_non_null(frame);
+    assert_int_equal(frame->cid, cid);
+    assert_int_equal(frame->init.cmd, FRAME_MSG);
+    assert_int_equal(FRAME_MSG_LEN(*frame), sizeof(data));
+    assert_memory_equal(frame->init.data, data, sizeof(frame->init.data));
+    size_t offset = sizeof(frame->init.data);
+    for (uint8_t seq = 0; seq < USB_DATA_MAX_FRAMES - 1; seq++) {
+        frame = (const USB_FRAME*)queue_pull(queue);
+        assert_non_null(frame);
+        assert_int_equal(frame->cid, cid);
+        assert_int_equal(frame->cont.seq, seq);
+        size_t len = sizeof(data) - offset;
+        if (len > sizeof(frame->cont.data)) {
+            len = sizeof(frame->cont.data);
+        }
+        assert_memory_equal(frame->cont.data, data + offset, len);
+        offset += len;
+    }
+    assert_int_equal(offset, sizeof(data));
+    assert_null(queue_pull(queue));
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(_test_queue_max_size_reply),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
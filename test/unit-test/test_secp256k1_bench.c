@@ -0,0 +1,124 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Throughput of the secp256k1 operations used by the firmware, to compare the table sizes
+// configured with SECP256K1_ECMULT_WINDOW and SECP256K1_ECMULT_GEN_PRECISION. The numbers are
+// only meaningful relative to each other on the same machine.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+
+#include <secp256k1.h>
+#include <wally_bip32.h>
+#include <wally_core.h>
+#include <wally_crypto.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define ITERATIONS 200
+
+static const uint8_t _seckey[32] = {
+    0xa2, 0xd8, 0xcf, 0x54, 0x3c, 0x60, 0xd6, 0x5a, 0xc9, 0x54, 0xb6, 0x0c, 0x26, 0x40, 0x4c, 0x2a,
+    0x55, 0x47, 0x6f, 0xb1, 0x6c, 0x53, 0xce, 0x97, 0xf6, 0x4c, 0x43, 0x9b, 0x87, 0xae, 0x1c, 0x01,
+};
+
+static void _report(const char* name, clock_t start)
+{
+    const double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf(
+        "secp256k1 window %d, gen precision %d: %-16s %8.1f us/op\n",
+        SECP256K1_ECMULT_WINDOW,
+        SECP256K1_ECMULT_GEN_PRECISION,
+        name,
+        seconds * 1e6 / ITERATIONS);
+}
+
+static void _msg(uint32_t i, uint8_t* msg_out)
+{
+    assert_int_equal(WALLY_OK, wally_sha256((const uint8_t*)&i, sizeof(i), msg_out, SHA256_LEN));
+}
+
+static void _bench_sign_verify(void** state)
+{
+    const secp256k1_context* ctx = wally_get_secp_context();
+    secp256k1_pubkey pubkey;
+    assert_true(secp256k1_ec_pubkey_create(ctx, &pubkey, _seckey));
+
+    secp256k1_ecdsa_signature sigs[ITERATIONS];
+    uint8_t msg[SHA256_LEN];
+
+    clock_t start = clock();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        _msg(i, msg);
+        assert_true(secp256k1_ecdsa_sign(ctx, &sigs[i], msg, _seckey, NULL, NULL));
+    }
+    _report("sign", start);
+
+    start = clock();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        _msg(i, msg);
+        assert_true(secp256k1_ecdsa_verify(ctx, &sigs[i], msg, &pubkey));
+    }
+    _report("verify", start);
+}
+
+static void _bench_pubkey(void** state)
+{
+    const secp256k1_context* ctx = wally_get_secp_context();
+    uint8_t seckey[32];
+    memcpy(seckey, _seckey, sizeof(seckey));
+    secp256k1_pubkey pubkey;
+
+    const clock_t start = clock();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        seckey[31] = (uint8_t)i;
+        assert_true(secp256k1_ec_pubkey_create(ctx, &pubkey, seckey));
+    }
+    _report("pubkey create", start);
+}
+
+static void _bench_bip32_derive_public(void** state)
+{
+    struct ext_key master;
+    assert_int_equal(
+        WALLY_OK,
+        bip32_key_from_seed(_seckey, sizeof(_seckey), BIP32_VER_MAIN_PRIVATE, 0, &master));
+    // Public derivation, like for xpubs and addresses.
+    assert_int_equal(WALLY_OK, bip32_key_strip_private_key(&master));
+    struct ext_key child;
+
+    const clock_t start = clock();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        assert_int_equal(
+            WALLY_OK,
+            bip32_key_from_parent(
+                &master, i, BIP32_FLAG_KEY_PUBLIC | BIP32_FLAG_SKIP_HASH, &child));
+    }
+    _report("bip32 derive xpub", start);
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(_bench_sign_verify),
+        cmocka_unit_test(_bench_pubkey),
+        cmocka_unit_test(_bench_bip32_derive_public),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
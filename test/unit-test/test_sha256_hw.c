@@ -0,0 +1,248 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <wally_crypto.h>
+
+// sha256_hw.c runs on top of the real ASF4 hal_sha_sync.c. Only the ICM register layer (hpl) below
+// it is replaced by a software model of the engine, which like the hardware reads and writes the
+// intermediate hash in `ctx->digest`.
+#define _UNIT_TEST_
+#include <hal_sha_sync.h>
+struct sha_sync_descriptor HASH_ALGORITHM_0;
+
+#include "asf4-drivers/hal/src/hal_sha_sync.c"
+#include "sha256_hw.c"
+
+static const uint32_t _k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static uint32_t _ror(uint32_t x, unsigned int n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+static uint32_t _read_be(const uint8_t* in)
+{
+    return (uint32_t)in[0] << 24 | (uint32_t)in[1] << 16 | (uint32_t)in[2] << 8 | in[3];
+}
+
+static void _write_be(uint8_t* out, uint32_t value)
+{
+    out[0] = value >> 24;
+    out[1] = value >> 16;
+    out[2] = value >> 8;
+    out[3] = value;
+}
+
+// One SHA-256 block, on the intermediate hash in the byte order of the final digest.
+static void _compress(uint8_t* digest, const uint8_t* block)
+{
+    uint32_t w[64];
+    uint32_t h[8];
+    for (int i = 0; i < 16; i++) {
+        w[i] = _read_be(&block[4 * i]);
+    }
+    for (int i = 16; i < 64; i++) {
+        const uint32_t s0 = _ror(w[i - 15], 7) ^ _ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        const uint32_t s1 = _ror(w[i - 2], 17) ^ _ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    for (int i = 0; i < 8; i++) {
+        h[i] = _read_be(&digest[4 * i]);
+    }
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], hh = h[7];
+    for (int i = 0; i < 64; i++) {
+        const uint32_t t1 = hh + (_ror(e, 6) ^ _ror(e, 11) ^ _ror(e, 25)) + ((e & f) ^ (~e & g)) +
+                            _k[i] + w[i];
+        const uint32_t t2 = (_ror(a, 2) ^ _ror(a, 13) ^ _ror(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        hh = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    const uint32_t out[8] = {a, b, c, d, e, f, g, hh};
+    for (int i = 0; i < 8; i++) {
+        _write_be(&digest[4 * i], h[i] + out[i]);
+    }
+}
+
+int32_t _sha_sync_sha256_start(struct _sha_sync_device* const dev)
+{
+    static const uint32_t iv[8] = {
+        0x6a09e667,
+        0xbb67ae85,
+        0x3c6ef372,
+        0xa54ff53a,
+        0x510e527f,
+        0x9b05688c,
+        0x1f83d9ab,
+        0x5be0cd19,
+    };
+    for (int i = 0; i < 8; i++) {
+        _write_be(&dev->ctx->digest[4 * i], iv[i]);
+    }
+    return ERR_NONE;
+}
+
+int32_t _sha_sync_sha256_process(
+    struct _sha_sync_device* const dev,
+    const uint8_t* input,
+    uint32_t length)
+{
+    // The engine reads its input word by word.
+    assert_int_equal((uintptr_t)input % 4, 0);
+    assert_int_equal(length % 64, 0);
+    for (uint32_t i = 0; i < length; i += 64) {
+        _compress(dev->ctx->digest, &input[i]);
+    }
+    return ERR_NONE;
+}
+
+int32_t _sha_sync_init(struct _sha_sync_device* const dev, void* const hw)
+{
+    return ERR_NONE;
+}
+
+int32_t _sha_sync_deinit(struct _sha_sync_device* const dev)
+{
+    return ERR_NONE;
+}
+
+int32_t _sha_sync_enable(struct _sha_sync_device* const dev)
+{
+    return ERR_NONE;
+}
+
+int32_t _sha_sync_disable(struct _sha_sync_device* const dev)
+{
+    return ERR_NONE;
+}
+
+int32_t _sha_sync_sha1_start(struct _sha_sync_device* const dev)
+{
+    fail();
+    return ERR_UNSUPPORTED_OP;
+}
+
+int32_t _sha_sync_sha1_process(
+    struct _sha_sync_device* const dev,
+    const uint8_t* input,
+    uint32_t length)
+{
+    fail();
+    return ERR_UNSUPPORTED_OP;
+}
+
+static void _reference(const uint8_t* data, size_t len, uint8_t* out)
+{
+    assert_int_equal(WALLY_OK, wally_sha256(data, len, out, SHA256_LEN));
+}
+
+static void _test_sha256_hw_abc(void** state)
+{
+    static const uint8_t expected[SHA256_LEN] = {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+        0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+    };
+    sha256_hw_state_t hasher;
+    uint8_t digest[SHA256_LEN];
+    sha256_hw_init(&hasher);
+    sha256_hw_update(&hasher, (const uint8_t*)"abc", 3);
+    sha256_hw_finish(&hasher, digest);
+    assert_memory_equal(digest, expected, sizeof(expected));
+}
+
+static void _test_sha256_hw_interleaved(void** state)
+{
+    // Word aligned, so that both the direct and the copying path of sha256_hw_update() are used.
+    static uint8_t data[600] __attribute__((aligned(4)));
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 7);
+    }
+
+    // Three hashers in progress at the same time share the engine, fed in pieces that do not line
+    // up with the block size, some of them unaligned.
+    static const size_t pieces[] = {1, 37, 64, 3, 128, 63, 65, 200, 0, 2};
+    for (size_t skip = 0; skip < 3; skip++) {
+        sha256_hw_state_t hasher_all;
+        sha256_hw_state_t hasher_odd;
+        sha256_hw_state_t hasher_copy;
+        sha256_hw_init(&hasher_all);
+        sha256_hw_init(&hasher_odd);
+
+        // `hasher_odd` hashes every piece starting `skip` bytes in.
+        uint8_t expected_odd_input[sizeof(data)];
+        size_t expected_odd_len = 0;
+        size_t offset = 0;
+        for (size_t i = 0; i < sizeof(pieces) / sizeof(pieces[0]); i++) {
+            const size_t len = pieces[i];
+            sha256_hw_update(&hasher_all, &data[offset], len);
+            if (len > skip) {
+                sha256_hw_update(&hasher_odd, &data[offset + skip], len - skip);
+                memcpy(&expected_odd_input[expected_odd_len], &data[offset + skip], len - skip);
+                expected_odd_len += len - skip;
+            }
+            if (i == 4) {
+                // The state can be copied and continued separately.
+                hasher_copy = hasher_all;
+            }
+            offset += len;
+        }
+        const size_t copy_len = pieces[0] + pieces[1] + pieces[2] + pieces[3] + pieces[4];
+        sha256_hw_update(&hasher_copy, &data[copy_len], 5);
+
+        uint8_t digest[SHA256_LEN];
+        uint8_t expected[SHA256_LEN];
+
+        sha256_hw_finish(&hasher_odd, digest);
+        _reference(expected_odd_input, expected_odd_len, expected);
+        assert_memory_equal(digest, expected, sizeof(expected));
+
+        sha256_hw_finish(&hasher_all, digest);
+        _reference(data, offset, expected);
+        assert_memory_equal(digest, expected, sizeof(expected));
+
+        sha256_hw_finish(&hasher_copy, digest);
+        _reference(data, copy_len + 5, expected);
+        assert_memory_equal(digest, expected, sizeof(expected));
+    }
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(_test_sha256_hw_abc),
+        cmocka_unit_test(_test_sha256_hw_interleaved),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
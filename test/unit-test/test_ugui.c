@@ -39,6 +39,15 @@ static void _set_pixel(UG_S16 x, UG_S16 y, UG_COLOR color)
     /* nop */
 }
 
+static UG_COLOR _pixels[64][128];
+
+static void _record_pixel(UG_S16 x, UG_S16 y, UG_COLOR color)
+{
+    if (x >= 0 && x < 128 && y >= 0 && y < 64) {
+        _pixels[y][x] = color;
+    }
+}
+
 static void _test_ugui_word_wrap(void** state)
 {
     (void)state; /* unused */
@@ -52,10 +61,72 @@ static void _test_ugui_word_wrap(void** state)
     }
 }
 
+static void _test_ugui_layout(void** state)
+{
+    (void)state; /* unused */
+    static UG_COLOR expected[64][128];
+    const char* strings[] = {
+        "",
+        "Bitcoin",
+        "bc1qxy2kgdygjrsqtzq2n0yrf2493p83kkfjhx0wlh",
+        "Line one\nline two\n\nline four",
+        "Send 0.1 BTC\nto an address that\nis much too long for one line",
+        // Chars the font does not have are skipped.
+        "Tab\tand \x01 control chars",
+        // More lines than UG_LAYOUT_MAX_LINES.
+        "1\n2\n3\n4\n5\n6\n7\n8\n9\n10",
+    };
+    const size_t overflowing = sizeof(strings) / sizeof(*strings) - 1;
+    UG_Init(&gui, _record_pixel, &font_font_a_11X10, 128, 64);
+    UG_FontSetVSpace(2);
+    for (size_t i = 0; i < sizeof(strings) / sizeof(*strings); i++) {
+        for (int mode = UG_LAYOUT_BREAK; mode <= UG_LAYOUT_CENTERED; mode++) {
+            for (int k = 0; k < 6; k++) {
+                const UG_S16 x = -20 + (k / 2) * 30;
+                const bool inverted = k % 2;
+                const UG_S16 y = 3;
+                UG_S16 width;
+                UG_S16 height;
+                memset(_pixels, 0, sizeof(_pixels));
+                switch (mode) {
+                case UG_LAYOUT_BREAK:
+                    UG_PutString(x, y, strings[i], inverted);
+                    break;
+                case UG_LAYOUT_NO_BREAK:
+                    UG_PutStringNoBreak(x, y, strings[i], inverted);
+                    break;
+                default:
+                    UG_MeasureStringCentered(&width, &height, strings[i]);
+                    UG_PutStringCentered(x, y, width, height, strings[i], inverted);
+                    break;
+                }
+                memcpy(expected, _pixels, sizeof(_pixels));
+
+                UG_LAYOUT layout;
+                if (mode == UG_LAYOUT_CENTERED) {
+                    UG_MeasureStringCentered(&width, &height, strings[i]);
+                } else {
+                    width = 0;
+                    height = 0;
+                }
+                UG_LayoutString(
+                    &layout, strings[i], (UG_LAYOUT_MODE)mode, x, width, height, inverted);
+                // Only the last string has more runs than fit in the layout.
+                assert_int_equal(layout.overflow, i == overflowing);
+                memset(_pixels, 0, sizeof(_pixels));
+                UG_PutLayout(&layout, strings[i], x, y);
+                assert_memory_equal(_pixels, expected, sizeof(_pixels));
+            }
+        }
+    }
+    UG_FontSetVSpace(0);
+}
+
 int main(void)
 {
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(_test_ugui_word_wrap),
+        cmocka_unit_test(_test_ugui_layout),
     };
     return cmocka_run_group_tests(tests, NULL, NULL);
 }
@@ -0,0 +1,134 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <cmocka.h>
+
+#include <ui/screen_stack.h>
+
+// Included to check the frame statistics. Without the frame timer (TESTING), every call to
+// `screen_process()` is one frame period.
+#include "ui/screen_process.c"
+
+static int _renders = 0;
+
+static void _render(component_t* component)
+{
+    _renders++;
+}
+
+static void _cleanup(component_t* component) {}
+
+static const component_functions_t _functions = {
+    .cleanup = _cleanup,
+    .render = _render,
+    .on_event = NULL,
+};
+
+static component_t _component_a = {.f = &_functions};
+static component_t _component_b = {.f = &_functions};
+
+static int _setup(void** state)
+{
+    _frame_tick = 0;
+    _rendered_tick = 0;
+    _defer_frame = false;
+    memset(&_stats, 0, sizeof(_stats));
+    _renders = 0;
+    return 0;
+}
+
+static int _teardown(void** state)
+{
+    ui_screen_stack_pop_all();
+    ui_screen_stack_cleanup();
+    return 0;
+}
+
+static void _test_screen_process_every_frame(void** state)
+{
+    ui_screen_stack_push(&_component_a);
+    for (int i = 0; i < 10; i++) {
+        screen_process();
+    }
+    assert_int_equal(_renders, 10);
+    assert_int_equal(_stats.frames_rendered, 10);
+    assert_int_equal(_stats.frames_dropped, 0);
+    assert_int_equal(_stats.max_frame_gap, 1);
+}
+
+static void _test_screen_process_deferral_capped(void** state)
+{
+    ui_screen_stack_push(&_component_a);
+    screen_process();
+    assert_int_equal(_renders, 1);
+
+    // With USB traffic in every iteration, a frame is still rendered every
+    // SCREEN_MAX_DEFERRED_FRAMES periods.
+    for (int frame = 1; frame <= 3 * SCREEN_MAX_DEFERRED_FRAMES; frame++) {
+        screen_process_defer_frame();
+        screen_process();
+        assert_int_equal(_renders, 1 + frame / SCREEN_MAX_DEFERRED_FRAMES);
+    }
+    assert_int_equal(_stats.frames_rendered, 4);
+    assert_int_equal(_stats.frames_dropped, 3 * (SCREEN_MAX_DEFERRED_FRAMES - 1));
+    assert_int_equal(_stats.max_frame_gap, SCREEN_MAX_DEFERRED_FRAMES);
+
+    // The deferral only applies to the iteration it was requested in.
+    screen_process();
+    assert_int_equal(_renders, 5);
+}
+
+static void _test_screen_process_new_screen_not_deferred(void** state)
+{
+    ui_screen_stack_push(&_component_a);
+    screen_process();
+    screen_process_defer_frame();
+    screen_process();
+    screen_process_defer_frame();
+    screen_process();
+    assert_int_equal(_renders, 1);
+
+    // A screen change is rendered right away, even while frames are deferred.
+    ui_screen_stack_push(&_component_b);
+    screen_process_defer_frame();
+    screen_process();
+    assert_int_equal(_renders, 2);
+    assert_int_equal(_stats.frames_rendered, 2);
+    assert_int_equal(_stats.frames_dropped, 2);
+    assert_int_equal(_stats.max_frame_gap, 3);
+
+    // So is going back to the previous screen.
+    ui_screen_stack_pop();
+    screen_process_defer_frame();
+    screen_process();
+    assert_int_equal(_renders, 3);
+    assert_int_equal(_stats.frames_dropped, 2);
+    assert_int_equal(_stats.max_frame_gap, 3);
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test_setup_teardown(_test_screen_process_every_frame, _setup, _teardown),
+        cmocka_unit_test_setup_teardown(_test_screen_process_deferral_capped, _setup, _teardown),
+        cmocka_unit_test_setup_teardown(
+            _test_screen_process_new_screen_not_deferred, _setup, _teardown),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,107 @@
+// Copyright 2026 Shift Crypto AG
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+
+#include <ui/word_prefix.h>
+
+#include <string.h>
+
+static const char* const _wordlist[] = {
+    "act",
+    "action",
+    "actor",
+    "actress",
+    "actual",
+    "adapt",
+    "zoo",
+};
+#define WORDLIST_SIZE (sizeof(_wordlist) / sizeof(_wordlist[0]))
+
+static word_prefix_range_t _range(const char* prefix)
+{
+    return word_prefix_range(_wordlist, WORDLIST_SIZE, prefix, strlen(prefix));
+}
+
+static void _assert_next_chars(const char* prefix, const char* expected)
+{
+    char chars[27];
+    word_prefix_next_chars(_wordlist, _range(prefix), strlen(prefix), chars, sizeof(chars));
+    assert_string_equal(chars, expected);
+}
+
+static void test_word_prefix_range(void** state)
+{
+    word_prefix_range_t range = _range("");
+    assert_int_equal(range.begin, 0);
+    assert_int_equal(range.end, WORDLIST_SIZE);
+
+    range = _range("act");
+    assert_int_equal(range.begin, 0);
+    assert_int_equal(range.end, 5);
+
+    range = _range("actr");
+    assert_int_equal(range.begin, 3);
+    assert_int_equal(range.end, 4);
+
+    range = _range("z");
+    assert_int_equal(range.begin, 6);
+    assert_int_equal(range.end, 7);
+
+    range = _range("ab");
+    assert_int_equal(range.begin, range.end);
+    range = _range("zz");
+    assert_int_equal(range.begin, range.end);
+    range = _range("actually");
+    assert_int_equal(range.begin, range.end);
+}
+
+static void test_word_prefix_next_chars(void** state)
+{
+    _assert_next_chars("", "az");
+    _assert_next_chars("a", "cd");
+    _assert_next_chars("ad", "a");
+    _assert_next_chars("act", "ioru");
+    _assert_next_chars("acto", "r");
+    _assert_next_chars("actor", "");
+    _assert_next_chars("b", "");
+
+    // Truncated to the output size.
+    char chars[2];
+    word_prefix_next_chars(_wordlist, _range("act"), 3, chars, sizeof(chars));
+    assert_string_equal(chars, "i");
+}
+
+static void test_word_prefix_is_word(void** state)
+{
+    assert_true(word_prefix_is_word(_wordlist, _range("act"), 3));
+    assert_true(word_prefix_is_word(_wordlist, _range("actor"), 5));
+    assert_true(word_prefix_is_word(_wordlist, _range("zoo"), 3));
+    assert_false(word_prefix_is_word(_wordlist, _range(""), 0));
+    assert_false(word_prefix_is_word(_wordlist, _range("acto"), 4));
+    assert_false(word_prefix_is_word(_wordlist, _range("b"), 1));
+}
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test(test_word_prefix_range),
+        cmocka_unit_test(test_word_prefix_next_chars),
+        cmocka_unit_test(test_word_prefix_is_word),
+    };
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -20,6 +20,16 @@ fn main() {
     let out_dir = &args[2];
     let mut config = prost_build::Config::new();
     config.out_dir(out_dir);
+    // Decoded without copying, referencing the buffer of the decrypted request. These fields can
+    // be large and are on the hot path when signing.
+    config.bytes([
+        ".shiftcrypto.bitbox02.BTCSignInputRequest.prevOutHash",
+        ".shiftcrypto.bitbox02.BTCPrevTxInputRequest.prev_out_hash",
+        ".shiftcrypto.bitbox02.BTCPrevTxInputRequest.signature_script",
+        ".shiftcrypto.bitbox02.BTCPrevTxOutputRequest.pubkey_script",
+        ".shiftcrypto.bitbox02.ETHSignRequest.data",
+        ".shiftcrypto.bitbox02.ETHSignEIP1559Request.data",
+    ]);
     config
         .compile_protos(&["hww.proto", "backup.proto"], &[messages_dir])
         .unwrap();